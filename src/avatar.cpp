@@ -1006,6 +1006,29 @@ mfaction_id avatar::get_monster_faction() const
     return monfaction_player.id();
 }
 
+void avatar::update_body_in_steps( const bool in_steps )
+{
+    if( body_updated_to && ( *body_updated_to >= calendar::turn ||
+                             calendar::turn - *body_updated_to > body_update_step ) ) {
+        // Time was changed from outside, e.g. by the debug menu.
+        body_updated_to.reset();
+    }
+    if( in_steps ) {
+        if( !body_updated_to ) {
+            body_updated_to = calendar::turn - 1_turns;
+        }
+        if( calendar::once_every( body_update_step ) ) {
+            update_body( *body_updated_to, calendar::turn );
+            body_updated_to = calendar::turn;
+        }
+    } else if( body_updated_to ) {
+        update_body( *body_updated_to, calendar::turn );
+        body_updated_to.reset();
+    } else {
+        update_body();
+    }
+}
+
 void avatar::reset_stats()
 {
     const int current_stim = get_stim();
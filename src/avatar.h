@@ -6,6 +6,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -161,6 +162,17 @@ class avatar : public Character
 
         /** Resets stats, and applies effects in an idempotent manner */
         void reset_stats() override;
+        /**
+         * Updates the body for the current turn. While @p in_steps is set, that only happens
+         * every @ref body_update_step turns, covering the turns in between. Once it is unset
+         * again, the turns left over from the last step are caught up on right away.
+         */
+        void update_body_in_steps( bool in_steps );
+        /** Whether the last call to @ref update_body_in_steps was in steps. */
+        bool is_body_updated_in_steps() const {
+            return body_updated_to.has_value();
+        }
+        static constexpr time_duration body_update_step = 10_turns;
         /** Resets all missions before saving character to template */
         void reset_all_missions();
 
@@ -454,6 +466,9 @@ class avatar : public Character
 
         object_type grab_type;
 
+        // Turn the body has been updated to by update_body_in_steps(), if it is behind.
+        std::optional<time_point> body_updated_to;
+
         monster_visible_info mon_visible;
 
         /**
@@ -23,6 +23,9 @@
 /** How much light moon provides per lit-up quarter (Full-moon light is four times this value) */
 static constexpr float moonlight_per_quarter = 1.5f;
 
+static const option_ref<std::string> option_24_HOUR( "24_HOUR" );
+static const option_ref<bool> option_SHOW_MONTHS( "SHOW_MONTHS" );
+
 // Divided by 100 to prevent overflowing when converted to moves
 const int calendar::INDEFINITELY_LONG( std::numeric_limits<int>::max() / 100 );
 static bool is_eternal_season = false;
@@ -640,7 +643,7 @@ std::string to_string_time_of_day( const time_point &p )
     const int hour = hour_of_day<int>( p );
     const int minute = minute_of_hour<int>( p );
     const int second = to_seconds<int>( time_past_midnight( p ) ) % 60;
-    const std::string format_type = get_option<std::string>( "24_HOUR" );
+    const std::string &format_type = option_24_HOUR.get();
 
     if( format_type == "military" ) {
         return string_format( "%02d%02d.%02d", hour, minute, second );
@@ -834,7 +837,7 @@ std::string to_string( const time_point &p )
 {
     const int year = calendar::years_since_cataclysm( p ) + 1;
     const std::string time = to_string_time_of_day( p );
-    if( get_option<bool>( "SHOW_MONTHS" ) && calendar::year_length() == 364_days ) {
+    if( option_SHOW_MONTHS.get() && calendar::year_length() == 364_days ) {
         const std::pair<month, int> month_day = month_and_day( p );
 
         //~ 1 is the year, 2 is the month, 3 is the day, 4 is the time of the day in its usual format
@@ -983,7 +986,7 @@ std::string get_diary_time_str( const time_point &turn, time_accuracy acc )
         case time_accuracy::FULL:
             return to_string( turn );
         case time_accuracy::PARTIAL:
-            if( get_option<bool>( "SHOW_MONTHS" ) ) {
+            if( option_SHOW_MONTHS.get() ) {
                 // partial accuracy, able to see the sky
                 //~ Time of year:
                 //~ $1 = year since Cataclysm
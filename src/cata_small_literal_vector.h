@@ -26,6 +26,10 @@ struct alignas( T * ) small_literal_vector {
     static_assert( std::is_trivially_default_constructible_v<T>,
                    "T must be trivially default constuctible." );
 
+    using value_type = T;
+    using iterator = T *;
+    using const_iterator = const T *;
+
     small_literal_vector() : heap_( nullptr ), capacity_( kInlineCount ), len_( 0 ) {}
     small_literal_vector( const small_literal_vector &other ) : capacity_( kInlineCount ), len_( 0 ) {
         copy_init( other );
@@ -85,6 +89,18 @@ struct alignas( T * ) small_literal_vector {
         return len_;
     }
 
+    bool empty() const {
+        return len_ == 0;
+    }
+
+    T &operator[]( size_t i ) {
+        return data()[i];
+    }
+
+    const T &operator[]( size_t i ) const {
+        return data()[i];
+    }
+
     void push_back( const T &t ) {
         ensure_capacity_for( size() + 1 );
         *end() = t;
@@ -19,6 +19,7 @@
 #include <stdexcept>
 #include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <variant>
 
 #include "action.h"
@@ -27,6 +28,7 @@
 #include "calendar.h"
 #include "cata_assert.h"
 #include "cata_path.h"
+#include "cata_scope_helpers.h"
 #include "cata_utility.h"
 #include "catacharset.h"
 #include "character.h"
@@ -45,6 +47,7 @@
 #include "field_type.h"
 #include "flexbuffer_json.h"
 #include "game.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "item.h"
 #include "item_factory.h"
@@ -297,6 +300,14 @@ const tile_type *tileset::find_tile_type( const std::string &id ) const
     return iter != tile_ids.end() ? &iter->second : nullptr;
 }
 
+bool tileset::has_animated_tiles() const
+{
+    return std::any_of( tile_ids.begin(), tile_ids.end(),
+    []( const std::pair<const std::string, tile_type> &entry ) {
+        return entry.second.animated;
+    } );
+}
+
 std::optional<tile_lookup_res>
 tileset::find_tile_type_by_season( const std::string &id, season_type season ) const
 {
@@ -365,6 +376,8 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     tileset_mutation_overlay_ordering.clear();
 
     tileset_ptr = cache.load_tileset( tileset_id, renderer, precheck, force, pump_events, terrain );
+    int_id_lookup = {};
+    static_layers = {};
 
     set_draw_scale( 16 );
 
@@ -376,6 +389,9 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
 
 void cata_tiles::reinit()
 {
+    // Game data may have been reloaded, so int ids may refer to different objects now
+    int_id_lookup = {};
+    static_layers = {};
     set_draw_scale( 16 );
     RenderClear( renderer );
 }
@@ -1353,6 +1369,13 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
         geometry->rect( renderer, clipRect, SDL_Color() );
     }
 
+    // Sprites are queued per texture and submitted in bulk. Everything in here
+    // that draws something else must flush first.
+    sprite_batch.set_enabled( renderer, true );
+    on_out_of_scope disable_batch( [this]() {
+        sprite_batch.set_enabled( renderer, false );
+    } );
+
     const point s = get_window_base_tile_counts( point( width, height ) );
 
     init_light();
@@ -1745,6 +1768,10 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
         }
     };
 
+    // draw_static_layers() draws the first layers on its own.
+    cata_assert( drawing_layers[num_static_layers - 1] == &cata_tiles::draw_field_or_item );
+    draw_static_layers( dest, center, width, height, top_any_tile_range );
+
     // Skip drawing shadow of critters above if there is no shadow sprite
     bool do_draw_shadow = false;
     if( find_tile_looks_like( "shadow", TILE_CATEGORY::NONE, "" ) ) {
@@ -1765,9 +1792,19 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
                 p.com.height_3d = ( cur_zlevel - center.z() ) * zlevel_height;
             }
             // For each layer
-            for( auto f : drawing_layers ) {
+            for( size_t layer = 0; layer < drawing_layers.size(); ++layer ) {
+                const auto f = drawing_layers[layer];
                 // For each tile
                 for( tile_render_info &p : here.draw_points_cache[cur_zlevel][row] ) {
+                    if( layer < num_static_layers && cur_zlevel == center.z() ) {
+                        // Already drawn by draw_static_layers()
+                        if( const std::optional<size_t> idx = static_layer_index( p.com.pos ) ) {
+                            if( layer == 0 ) {
+                                p.com.height_3d = static_layers.height_3d[*idx];
+                            }
+                            continue;
+                        }
+                    }
                     if( const tile_render_info::vision_effect * const
                         var = std::get_if<tile_render_info::vision_effect>( &p.var ) ) {
                         if( f == &cata_tiles::draw_terrain ) {
@@ -1943,6 +1980,7 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
         }
     }
 
+    sprite_batch.set_enabled( renderer, false );
     printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
                   "SDL_RenderSetClipRect failed" );
 }
@@ -1952,6 +1990,275 @@ void cata_tiles::set_draw_cache_dirty()
     get_map().draw_points_cache_dirty = true;
 }
 
+bool cata_tiles::can_cache_static_layers()
+{
+    if( is_isometric() || !SDL_RenderTargetSupported( renderer.get() ) ) {
+        return false;
+    }
+    // Overrides reach into neighbouring tiles and are only shown for a few frames.
+    if( !radiation_override.empty() || !terrain_override.empty() || !furniture_override.empty() ||
+        !graffiti_override.empty() || !trap_override.empty() || !field_override.empty() ||
+        !item_override.empty() || !vpart_override.empty() || !monster_override.empty() ) {
+        return false;
+    }
+    static_layer_cache &sc = static_layers;
+    if( sc.checked_tileset != tileset_ptr.get() ) {
+        sc.checked_tileset = tileset_ptr.get();
+        // Idle animations change without anything on the map changing, and layer
+        // offsets are not part of the maximum tile extent.
+        sc.tileset_fits = !tileset_ptr->has_animated_tiles();
+        for( const auto *layers : {
+                 &tileset_ptr->item_layer_data, &tileset_ptr->field_layer_data
+             } ) {
+            for( const auto &entry : *layers ) {
+                for( const layer_context_sprites &layer_var : entry.second ) {
+                    sc.tileset_fits &= layer_var.offset == point::zero;
+                }
+            }
+        }
+    }
+    // The extent is scaled with the zoom level, so check it every time.
+    return sc.tileset_fits &&
+           max_tile_extent.p_min.x >= 0 && max_tile_extent.p_min.y >= 0 &&
+           max_tile_extent.p_max.x <= tile_width && max_tile_extent.p_max.y <= tile_height;
+}
+
+size_t cata_tiles::static_layers_key( const tile_render_info &info )
+{
+    size_t seed = 0;
+    if( const tile_render_info::vision_effect * const
+        var = std::get_if<tile_render_info::vision_effect>( &info.var ) ) {
+        cata::hash_combine( seed, static_cast<int>( var->vis ) );
+        return seed;
+    }
+    const tile_render_info::sprite &var = std::get<tile_render_info::sprite>( info.var );
+    const tripoint_bub_ms &p = info.com.pos;
+    map &here = get_map();
+    avatar &you = get_avatar();
+
+    cata::hash_combine( seed, static_cast<int>( var.ll ) );
+    for( const bool invisible : var.invisible ) {
+        cata::hash_combine( seed, invisible );
+    }
+    if( var.invisible[0] ) {
+        // Only memory is drawn. Memorized ids are interned, so their address identifies them.
+        const memorized_tile &mt = you.get_memorized_tile( here.get_abs( p ) );
+        cata::hash_combine( seed, &mt.get_ter_id() );
+        cata::hash_combine( seed, mt.get_ter_subtile() );
+        cata::hash_combine( seed, mt.get_ter_rotation() );
+        cata::hash_combine( seed, &mt.get_dec_id() );
+        cata::hash_combine( seed, mt.get_dec_subtile() );
+        cata::hash_combine( seed, mt.get_dec_rotation() );
+        return seed;
+    }
+
+    // Connections and rotations depend on the neighbours. Each of them is looked up once;
+    // built-in traps follow from the terrain.
+    for( const tripoint_bub_ms &q : {
+             p + point::south, p + point::east, p + point::west, p + point::north
+         } ) {
+        const const_maptile neighbour = std::as_const( here ).maptile_at( q );
+        cata::hash_combine( seed, neighbour.get_ter().to_i() );
+        cata::hash_combine( seed, neighbour.get_furn().to_i() );
+        cata::hash_combine( seed, neighbour.get_trap().to_i() );
+        for( const std::pair<const field_type_id, field_entry> &fd : neighbour.get_field() ) {
+            cata::hash_combine( seed, fd.first.to_i() );
+        }
+    }
+    const const_maptile tile = std::as_const( here ).maptile_at( p );
+    cata::hash_combine( seed, tile.get_ter().to_i() );
+    cata::hash_combine( seed, tile.get_furn().to_i() );
+    cata::hash_combine( seed, tile.get_trap().to_i() );
+    for( const std::pair<const field_type_id, field_entry> &fd : tile.get_field() ) {
+        cata::hash_combine( seed, fd.first.to_i() );
+        cata::hash_combine( seed, fd.second.get_field_intensity() );
+    }
+    cata::hash_combine( seed, here.tr_at( p ).can_see( p, you ) );
+    cata::hash_combine( seed, here.partial_con_at( p ) != nullptr );
+    if( tile.has_graffiti() ) {
+        cata::hash_combine( seed, tile.get_graffiti() );
+        cata::hash_combine( seed, here.passable( p ) );
+    }
+    const auto hash_item = [&seed]( const item & it ) {
+        cata::hash_combine( seed, it.typeId() );
+        cata::hash_combine( seed, it.seed );
+        cata::hash_combine( seed, it.get_mtype() );
+        if( it.has_itype_variant() ) {
+            cata::hash_combine( seed, it.itype_variant().id );
+        }
+    };
+    if( tile.get_item_count() > 0 ) {
+        cata::hash_combine( seed, here.could_see_items( p, you ) );
+        for( const item &it : tile.get_items() ) {
+            hash_item( it );
+        }
+    }
+    // Items in a vehicle standing on the tile count too, so that the tile is drawn again
+    // whenever the vehicle or its cargo changes.
+    if( const optional_vpart_position vp = here.veh_at( p ) ) {
+        cata::hash_combine( seed, &vp->vehicle() );
+        cata::hash_combine( seed, vp->mount_pos() );
+        if( const std::optional<vpart_reference> cargo = vp.cargo() ) {
+            for( const item &it : cargo->items() ) {
+                hash_item( it );
+            }
+        }
+    }
+    return seed;
+}
+
+bool cata_tiles::draw_static_layers( const point &dest, const tripoint_bub_ms &center,
+                                     const int width, const int height,
+                                     const half_open_rectangle<point> &range )
+{
+    static_layer_cache &sc = static_layers;
+    sc.in_use = false;
+    if( !can_cache_static_layers() ) {
+        sc.keys.clear();
+        return false;
+    }
+
+    // The texture has the size of the render target, so tiles are drawn into it at
+    // their usual screen position.
+    SDL_Texture *const target = SDL_GetRenderTarget( renderer.get() );
+    point target_size;
+    if( target ? SDL_QueryTexture( target, nullptr, nullptr, &target_size.x, &target_size.y ) != 0 :
+        SDL_GetRendererOutputSize( renderer.get(), &target_size.x, &target_size.y ) != 0 ) {
+        sc.keys.clear();
+        return false;
+    }
+    if( !sc.texture || sc.texture_size != target_size ) {
+        sc.keys.clear();
+        sc.texture = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                    target_size.x, target_size.y );
+        if( !sc.texture ) {
+            return false;
+        }
+        SetTextureBlendMode( sc.texture, SDL_BLENDMODE_NONE );
+        sc.texture_size = target_size;
+    }
+
+    size_t frame_key = 0;
+    cata::hash_combine( frame_key, tileset_ptr.get() );
+    for( const int v : {
+             tile_width, tile_height, dest.x, dest.y, width, height, o.x, o.y, center.z(),
+             fov_3d_z_range, static_cast<int>( season_of_year( calendar::turn ) )
+         } ) {
+        cata::hash_combine( frame_key, v );
+    }
+    cata::hash_combine( frame_key, nv_goggles_activated );
+    if( frame_key != sc.frame_key || range.p_min != sc.tiles.p_min || range.p_max != sc.tiles.p_max ) {
+        sc.keys.clear();
+    }
+    sc.frame_key = frame_key;
+    sc.tiles = range;
+
+    const point size = range.p_max - range.p_min;
+    const size_t num_tiles = std::max( 0, size.x ) * std::max( 0, size.y );
+    // Tiles without draw points keep this key; it differs from uncached_tile_key.
+    sc.new_keys.assign( num_tiles, 1 );
+    sc.points.assign( num_tiles, nullptr );
+    sc.height_3d.resize( num_tiles, 0 );
+    map &here = get_map();
+    const int min_z = std::max( center.z() - fov_3d_z_range, -OVERMAP_DEPTH );
+    for( auto &z_rows : here.draw_points_cache ) {
+        const int z = z_rows.first;
+        if( z < min_z || z > center.z() ) {
+            continue;
+        }
+        for( auto &row_points : z_rows.second ) {
+            const int row = row_points.first;
+            if( row < range.p_min.y || row >= range.p_max.y ) {
+                continue;
+            }
+            for( tile_render_info &p : row_points.second ) {
+                const int col = player_to_tile( p.com.pos.xy() ).x;
+                if( col < range.p_min.x || col >= range.p_max.x ) {
+                    continue;
+                }
+                const size_t idx = ( row - range.p_min.y ) * size.x + col - range.p_min.x;
+                if( z != center.z() ) {
+                    // Lower levels are drawn interleaved with their dynamic layers, so the
+                    // whole tile has to be redrawn in order.
+                    sc.new_keys[idx] = uncached_tile_key;
+                } else if( sc.new_keys[idx] != uncached_tile_key ) {
+                    cata::hash_combine( sc.new_keys[idx], static_layers_key( p ) );
+                    sc.points[idx] = &p;
+                }
+            }
+        }
+    }
+
+    const bool redraw_all = sc.keys.size() != num_tiles;
+    sprite_batch.flush( renderer );
+    SetRenderTarget( renderer, sc.texture );
+    if( redraw_all ) {
+        // Also covers whatever the tiles don't, which is undefined in a new texture.
+        SetRenderDrawColor( renderer, 0, 0, 0, 0 );
+        RenderClear( renderer );
+    }
+    for( size_t idx = 0; idx < num_tiles; ++idx ) {
+        if( !redraw_all && sc.keys[idx] == sc.new_keys[idx] ) {
+            continue;
+        }
+        const int i = static_cast<int>( idx );
+        const point colrow = range.p_min + point( i % size.x, i / size.x );
+        const SDL_Rect tile_rect{
+            op.x + colrow.x * tile_width, op.y + colrow.y * tile_height, tile_width, tile_height
+        };
+        geometry->rect( renderer, tile_rect, SDL_Color() );
+        sc.height_3d[idx] = 0;
+        if( sc.new_keys[idx] == uncached_tile_key || !sc.points[idx] ) {
+            continue;
+        }
+        tile_render_info &p = *sc.points[idx];
+        int &height_3d = sc.height_3d[idx];
+        if( const tile_render_info::vision_effect * const
+            var = std::get_if<tile_render_info::vision_effect>( &p.var ) ) {
+            apply_vision_effects( p.com.pos, var->vis, height_3d );
+        } else if( const tile_render_info::sprite * const
+                   var = std::get_if<tile_render_info::sprite>( &p.var ) ) {
+            // The first num_static_layers entries of drawing_layers in draw().
+            draw_terrain( p.com.pos, var->ll, height_3d, var->invisible, false );
+            draw_furniture( p.com.pos, var->ll, height_3d, var->invisible, false );
+            draw_graffiti( p.com.pos, var->ll, height_3d, var->invisible, false );
+            draw_trap( p.com.pos, var->ll, height_3d, var->invisible, false );
+            draw_part_con( p.com.pos, var->ll, height_3d, var->invisible, false );
+            draw_field_or_item( p.com.pos, var->ll, height_3d, var->invisible, false );
+        }
+    }
+    sprite_batch.flush( renderer );
+    printErrorIf( SDL_SetRenderTarget( renderer.get(), target ) != 0, "SDL_SetRenderTarget failed" );
+
+    // Switching render targets resets the clip rect.
+    SDL_Rect clip_rect{ dest.x, dest.y, width, height };
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clip_rect ) != 0,
+                  "SDL_RenderSetClipRect failed" );
+    RenderCopy( renderer, sc.texture, &clip_rect, &clip_rect );
+
+    std::swap( sc.keys, sc.new_keys );
+    sc.in_use = true;
+    return true;
+}
+
+std::optional<size_t> cata_tiles::static_layer_index( const tripoint_bub_ms &pos ) const
+{
+    const static_layer_cache &sc = static_layers;
+    if( !sc.in_use ) {
+        return std::nullopt;
+    }
+    const point colrow = player_to_tile( pos.xy() );
+    if( !sc.tiles.contains( colrow ) ) {
+        return std::nullopt;
+    }
+    const size_t idx = ( colrow.y - sc.tiles.p_min.y ) * ( sc.tiles.p_max.x - sc.tiles.p_min.x ) +
+                       colrow.x - sc.tiles.p_min.x;
+    if( sc.keys[idx] == uncached_tile_key ) {
+        return std::nullopt;
+    }
+    return idx;
+}
+
 void cata_tiles::draw_minimap( const point &dest, const tripoint_bub_ms &center, int width,
                                int height )
 {
@@ -2284,6 +2591,62 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, const trip
             rota, ll, retract, apply_night_vision_goggles, height_3d, 0, "", point() );
 }
 
+bool cata_tiles::draw_from_int_id( const ter_id &t, const tripoint_bub_ms &pos, int subtile,
+                                   int rota, lit_level ll, bool apply_night_vision_goggles,
+                                   int &height_3d )
+{
+    return draw_from_id_string_internal( t.id().str(), TILE_CATEGORY::TERRAIN, empty_string, pos,
+                                         subtile, rota, ll, -1, apply_night_vision_goggles, height_3d, 0, "", point(),
+                                         &find_tile_cached( t ) );
+}
+
+bool cata_tiles::draw_from_int_id( const furn_id &f, const tripoint_bub_ms &pos, int subtile,
+                                   int rota, lit_level ll, bool apply_night_vision_goggles,
+                                   int &height_3d )
+{
+    return draw_from_id_string_internal( f.id().str(), TILE_CATEGORY::FURNITURE, empty_string, pos,
+                                         subtile, rota, ll, -1, apply_night_vision_goggles, height_3d, 0, "", point(),
+                                         &find_tile_cached( f ) );
+}
+
+void cata_tiles::validate_int_id_lookup()
+{
+    const season_type season = season_of_year( calendar::turn );
+    if( int_id_lookup.for_tileset != tileset_ptr.get() || int_id_lookup.season != season ) {
+        int_id_lookup = {};
+        int_id_lookup.for_tileset = tileset_ptr.get();
+        int_id_lookup.season = season;
+    }
+}
+
+const std::optional<tile_lookup_res> &cata_tiles::find_tile_cached( const ter_id &t )
+{
+    validate_int_id_lookup();
+    const size_t idx = t.to_i();
+    if( idx >= int_id_lookup.ter.size() ) {
+        int_id_lookup.ter.resize( std::max( idx + 1, ter_t::count() ) );
+    }
+    std::optional<std::optional<tile_lookup_res>> &entry = int_id_lookup.ter[idx];
+    if( !entry ) {
+        entry = find_tile_looks_like( t.id().str(), TILE_CATEGORY::TERRAIN, "" );
+    }
+    return *entry;
+}
+
+const std::optional<tile_lookup_res> &cata_tiles::find_tile_cached( const furn_id &f )
+{
+    validate_int_id_lookup();
+    const size_t idx = f.to_i();
+    if( idx >= int_id_lookup.furn.size() ) {
+        int_id_lookup.furn.resize( std::max( idx + 1, furn_t::count() ) );
+    }
+    std::optional<std::optional<tile_lookup_res>> &entry = int_id_lookup.furn[idx];
+    if( !entry ) {
+        entry = find_tile_looks_like( f.id().str(), TILE_CATEGORY::FURNITURE, "" );
+    }
+    return *entry;
+}
+
 std::optional<tile_lookup_res>
 cata_tiles::find_tile_with_season( const std::string &id ) const
 {
@@ -2518,7 +2881,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
         int subtile, int rota, lit_level ll, int retract,
         bool apply_night_vision_goggles, int &height_3d,
         int intensity_level, const std::string &variant,
-        const point &offset )
+        const point &offset, const std::optional<tile_lookup_res> *base_lookup )
 {
     bool nv_color_active = apply_night_vision_goggles && get_option<bool>( "NV_GREEN_TOGGLE" );
     // If the ID string does not produce a drawable tile
@@ -2571,7 +2934,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
     }
     // if a tile with intensity hasn't already been found then fall back to a base tile
     if( !res ) {
-        res = find_tile_looks_like( id, category, variant );
+        res = base_lookup ? *base_lookup : find_tile_looks_like( id, category, variant );
         if( res ) {
             tt = &res -> tile();
         }
@@ -3047,19 +3410,17 @@ bool cata_tiles::draw_sprite_at(
     destination.w = width * tile_width * tile.pixelscale / tileset_ptr->get_tile_width();
     destination.h = height * tile_height * tile.pixelscale / tileset_ptr->get_tile_height();
 
+    double angle = 0;
+    SDL_RendererFlip flip = SDL_FLIP_NONE;
     if( rotate_sprite ) {
         if( rota == -1 ) {
             // flip horizontally
-            ret = sprite_tex->render_copy_ex(
-                      renderer, &destination, 0, nullptr,
-                      static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL ) );
+            flip = static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL );
         } else {
             switch( rota % 4 ) {
                 default:
                 case 0:
                     // unrotated (and 180, with just two sprites)
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                      SDL_FLIP_NONE );
                     break;
                 case 1:
                     // 90 degrees (and 270, with just two sprites)
@@ -3072,23 +3433,14 @@ bool cata_tiles::draw_sprite_at(
 #endif
                     if( !is_isometric() ) {
                         // never rotate isometric tiles
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, -90, nullptr,
-                                                          SDL_FLIP_NONE );
-                    } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        angle = -90;
                     }
                     break;
                 case 2:
                     // 180 degrees, implemented with flips instead of rotation
                     if( !is_isometric() ) {
                         // never flip isometric tiles vertically
-                        ret = sprite_tex->render_copy_ex(
-                                  renderer, &destination, 0, nullptr,
-                                  static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
-                    } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        flip = static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL );
                     }
                     break;
                 case 3:
@@ -3102,19 +3454,14 @@ bool cata_tiles::draw_sprite_at(
 #endif
                     if( !is_isometric() ) {
                         // never rotate isometric tiles
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 90, nullptr,
-                                                          SDL_FLIP_NONE );
-                    } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        angle = 90;
                     }
                     break;
             }
         }
-    } else {
-        // don't rotate, same as case 0 above
-        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
     }
+    // queued while draw() has batching enabled, drawn right away otherwise
+    ret = sprite_tex->render_copy_ex( sprite_batch, renderer, destination, angle, flip );
 
     printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
     // this reference passes all the way back up the call chain back to
@@ -3249,6 +3596,7 @@ void cata_tiles::draw_square_below( const point_bub_ms &p, const nc_color &col,
         sdlrect.x = screen.x + divide_round_down( tile_width - sdlrect.w, 2 );
         sdlrect.y = screen.y + divide_round_down( tile_height - sdlrect.h, 2 );
     }
+    sprite_batch.flush( renderer );
     geometry->rect( renderer, sdlrect, sdlcol );
 }
 
@@ -3295,8 +3643,7 @@ bool cata_tiles::draw_terrain( const tripoint_bub_ms &p, const lit_level ll, int
         if( !neighborhood_overridden ) {
             return memorize_only
                    ? false
-                   : draw_from_id_string( tname, TILE_CATEGORY::TERRAIN, empty_string, p, subtile,
-                                          rotation, ll, nv_goggles_activated, height_3d );
+                   : draw_from_int_id( t, p, subtile, rotation, ll, nv_goggles_activated, height_3d );
         }
     }
     if( invisible[0] ? overridden : neighborhood_overridden ) {
@@ -3317,15 +3664,13 @@ bool cata_tiles::draw_terrain( const tripoint_bub_ms &p, const lit_level ll, int
                 get_terrain_orientation( p, rotation, subtile, terrain_override, invisible,
                                          rotate_group );
             }
-            const std::string &tname = t2.id().str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? lit_level::LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
             return memorize_only
                    ? false
-                   : draw_from_id_string( tname, TILE_CATEGORY::TERRAIN, empty_string, p, subtile,
-                                          rotation, lit, nv, height_3d );
+                   : draw_from_int_id( t2, p, subtile, rotation, lit, nv, height_3d );
         }
     } else if( invisible[0] ) {
         // try drawing memory if invisible and not overridden
@@ -3386,8 +3731,7 @@ bool cata_tiles::draw_furniture( const tripoint_bub_ms &p, const lit_level ll, i
         if( !neighborhood_overridden ) {
             return memorize_only
                    ? false
-                   : draw_from_id_string( fname, TILE_CATEGORY::FURNITURE, empty_string, p, subtile,
-                                          rotation, ll, nv_goggles_activated, height_3d );
+                   : draw_from_int_id( f, p, subtile, rotation, ll, nv_goggles_activated, height_3d );
         }
     }
     if( invisible[0] ? overridden : neighborhood_overridden ) {
@@ -3418,15 +3762,13 @@ bool cata_tiles::draw_furniture( const tripoint_bub_ms &p, const lit_level ll, i
                 get_tile_values_with_ter( p, f.to_i(), neighborhood, subtile, rotation, rotate_group );
             }
             get_tile_values_with_ter( p, f2.to_i(), neighborhood, subtile, rotation, 0 );
-            const std::string &fname = f2.id().str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? lit_level::LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
             return memorize_only
                    ? false
-                   : draw_from_id_string( fname, TILE_CATEGORY::FURNITURE, empty_string, p, subtile,
-                                          rotation, lit, nv, height_3d );
+                   : draw_from_int_id( f2, p, subtile, rotation, lit, nv, height_3d );
         }
     } else if( invisible[0] ) {
         // try drawing memory if invisible and not overridden
@@ -4248,6 +4590,7 @@ void cata_tiles::draw_zlevel_overlay( const tripoint_bub_ms &p, const lit_level
 
     // Change blend mode for transparency to work
     // Disable after to avoid visual bugs
+    sprite_batch.flush( renderer );
     SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_BLEND );
     geometry->rect( renderer, draw_rect, fog_color );
     SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_NONE );
@@ -26,6 +26,7 @@
 #include "pimpl.h"
 #include "point.h"
 #include "sdl_geometry.h"
+#include "sdl_sprite_batch.h"
 #include "sdl_wrappers.h"
 #include "type_id.h"
 #include "units.h"
@@ -39,6 +40,7 @@ class memorized_tile;
 class monster;
 class nc_color;
 class pixel_minimap;
+struct tile_render_info;
 enum class direction : unsigned int;
 enum class lit_level : int;
 enum class visibility_type : int;
@@ -150,6 +152,13 @@ class texture
             return SDL_RenderCopyEx( renderer.get(), sdl_texture_ptr.get(), &srcrect, dstrect, angle, center,
                                      flip );
         }
+        /// Same as above, but goes through @p batch, which may queue the sprite
+        /// instead of drawing it right away. Always rotates around the center.
+        int render_copy_ex( SpriteBatch &batch, const SDL_Renderer_Ptr &renderer,
+                            const SDL_Rect &dstrect, const double angle,
+                            const SDL_RendererFlip flip ) const {
+            return batch.render_copy_ex( renderer, sdl_texture_ptr.get(), srcrect, dstrect, angle, flip );
+        }
 };
 
 /**
@@ -272,6 +281,8 @@ class tileset
 
         tile_type &create_tile_type( const std::string &id, tile_type &&new_tile_type );
         const tile_type *find_tile_type( const std::string &id ) const;
+        /// Whether any tile uses an idle animation.
+        bool has_animated_tiles() const;
 
         /**
          * Looks up tile by id + season suffix AND just raw id
@@ -497,10 +508,75 @@ class cata_tiles
         bool draw_from_id_string_internal( const std::string &id, const tripoint_bub_ms &pos, int subtile,
                                            int rota,
                                            lit_level ll, int retract, bool apply_night_vision_goggles, int &height_3d );
+        // @param base_lookup if set, the result of find_tile_looks_like( id, category, variant )
         bool draw_from_id_string_internal( const std::string &id, TILE_CATEGORY category,
                                            const std::string &subcategory, const tripoint_bub_ms &pos, int subtile, int rota,
                                            lit_level ll, int retract, bool apply_night_vision_goggles, int &height_3d, int intensity_level,
-                                           const std::string &variant, const point &offset );
+                                           const std::string &variant, const point &offset,
+                                           const std::optional<tile_lookup_res> *base_lookup = nullptr );
+
+        /**
+         * find_tile_looks_like results for terrain and furniture without variant, indexed by
+         * int id, so that drawing them skips the string lookups and looks_like chains.
+         * Filled lazily; dropped when the tileset or the season changes.
+         * An empty outer optional means the id was not looked up yet.
+         */
+        struct int_id_lookup_cache {
+            const tileset *for_tileset = nullptr;
+            season_type season = season_type::NUM_SEASONS;
+            std::vector<std::optional<std::optional<tile_lookup_res>>> ter;
+            std::vector<std::optional<std::optional<tile_lookup_res>>> furn;
+        };
+        int_id_lookup_cache int_id_lookup;
+
+        void validate_int_id_lookup();
+        const std::optional<tile_lookup_res> &find_tile_cached( const ter_id &t );
+        const std::optional<tile_lookup_res> &find_tile_cached( const furn_id &f );
+
+        /**
+         * The static layers of the last frame: everything drawn by the first
+         * `num_static_layers` entries of the layer list in draw(), plus vision effects.
+         * They are kept in a texture so that draw() only redraws the screen tiles
+         * whose key changed. Creatures, vehicles and other dynamic layers are always
+         * drawn on top. Only used when no sprite reaches outside of its own tile,
+         * because tiles are redrawn independently of their neighbours.
+         */
+        struct static_layer_cache {
+            SDL_Texture_Ptr texture;
+            point texture_size;
+            // Whether the current frame uses the cache.
+            bool in_use = false;
+            // Everything that affects the whole frame, like the view and the tileset.
+            size_t frame_key = 0;
+            // Screen tiles covered by `keys`, indexed row by row.
+            half_open_rectangle<point> tiles;
+            std::vector<size_t> keys;
+            std::vector<size_t> new_keys;
+            // Center z-level draw point of each tile this frame, if any.
+            std::vector<tile_render_info *> points;
+            // height_3d after drawing the static layers of each tile
+            std::vector<int> height_3d;
+            // Whether the current tileset allows caching, checked once per tileset.
+            const tileset *checked_tileset = nullptr;
+            bool tileset_fits = false;
+        };
+        static_layer_cache static_layers;
+        static constexpr size_t num_static_layers = 6;
+        // Key for tiles that are always fully redrawn.
+        static constexpr size_t uncached_tile_key = 0;
+
+        bool can_cache_static_layers();
+        /// Hash of everything the static layers draw on a tile, see draw_static_layers().
+        static size_t static_layers_key( const tile_render_info &info );
+        /**
+         * Brings the static layer texture up to date and copies it to the screen.
+         * @returns false if the cache can't be used this frame, in which case
+         * everything has to be drawn as usual.
+         */
+        bool draw_static_layers( const point &dest, const tripoint_bub_ms &center, int width, int height,
+                                 const half_open_rectangle<point> &range );
+        /// Index of a screen tile in `static_layers.keys`, if the tile was taken from the cache.
+        std::optional<size_t> static_layer_index( const tripoint_bub_ms &pos ) const;
     protected:
         bool draw_from_id_string( const std::string &id, const tripoint_bub_ms &pos, int subtile, int rota,
                                   lit_level ll,
@@ -543,6 +619,13 @@ class cata_tiles
                                   const std::string &subcategory, const tripoint_bub_ms &pos, int subtile, int rota,
                                   lit_level ll, bool apply_night_vision_goggles, int &height_3d, int intensity_level,
                                   const std::string &variant, const point &offset );
+        /** Same as draw_from_id_string with the id of @ref t or @ref f, using the int id lookup cache. */
+        //@{
+        bool draw_from_int_id( const ter_id &t, const tripoint_bub_ms &pos, int subtile, int rota,
+                               lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        bool draw_from_int_id( const furn_id &f, const tripoint_bub_ms &pos, int subtile, int rota,
+                               lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        //@}
         bool draw_sprite_at(
             const tile_type &tile, const weighted_int_list<std::vector<int>> &svlist,
             const point &, unsigned int loc_rand, bool rota_fg, int rota, lit_level ll,
@@ -791,6 +874,9 @@ class cata_tiles
         /** Variables */
         const SDL_Renderer_Ptr &renderer;
         const GeometryRenderer_Ptr &geometry;
+        // Enabled for the duration of draw(). Flush it before drawing anything that
+        // is not a sprite.
+        SpriteBatch sprite_batch;
         tileset_cache &cache;
         std::shared_ptr<const tileset> tileset_ptr;
 
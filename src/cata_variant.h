@@ -8,6 +8,7 @@
 #include <functional>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -501,7 +502,7 @@ class cata_variant
 
 #define CATA_VARIANT_OPERATOR(op) \
     friend bool operator op( const cata_variant &l, const cata_variant &r ) { \
-        return l.as_pair() op r.as_pair(); \
+        return std::tie( l.type_, l.value_ ) op std::tie( r.type_, r.value_ ); \
     }
         CATA_VARIANT_OPERATOR( == )
         CATA_VARIANT_OPERATOR( != )
@@ -533,7 +534,11 @@ struct hash<cata_variant_type> {
 template<>
 struct hash<cata_variant> {
     size_t operator()( const cata_variant &v ) const noexcept {
-        return cata::tuple_hash()( v.as_pair() );
+        // Same as hashing as_pair(), without copying the string
+        size_t seed = 0;
+        cata::hash_combine( seed, v.type() );
+        cata::hash_combine( seed, v.get_string() );
+        return seed;
     }
 };
 
@@ -4699,9 +4699,43 @@ void Character::recalculate_bodyparts()
 }
 
 void Character::recalculate_enchantment_cache()
+{
+    enchantment_sources_dirty = true;
+    update_enchantment_cache();
+}
+
+void Character::add_enchantments( enchantment_sources &cached,
+                                  std::vector<std::pair<const enchantment *, bool>> &sources )
+{
+    if( enchantment_sources_dirty || sources != cached.sources ) {
+        cached.sources.swap( sources );
+        cached.static_sum->clear();
+        for( const std::pair<const enchantment *, bool> &source : cached.sources ) {
+            const enchantment &ench = *source.first;
+            if( ench.is_static() && ench.is_active( *this, source.second ) ) {
+                cached.static_sum->force_add( ench, *this );
+            }
+        }
+    }
+    enchantment_cache->force_add( *cached.static_sum );
+    // Adding one cache to another leaves out the details
+    const std::vector<std::pair<std::string, std::string>> &details = cached.static_sum->details;
+    enchantment_cache->details.insert( enchantment_cache->details.end(), details.begin(),
+                                       details.end() );
+    for( const std::pair<const enchantment *, bool> &source : cached.sources ) {
+        const enchantment &ench = *source.first;
+        if( !ench.is_static() && ench.is_active( *this, source.second ) ) {
+            enchantment_cache->force_add( ench, *this );
+        }
+    }
+}
+
+void Character::update_enchantment_cache()
 {
     enchantment_cache->clear();
 
+    // Whether a relic is held, wielded or worn can change in too many ways to keep track of,
+    // so those are always looked at again.
     cache_visit_items_with( "is_relic", &item::is_relic, [this]( const item & it ) {
         for( const enchant_cache &ench : it.get_proc_enchantments() ) {
             if( ench.is_active( *this, it ) ) {
@@ -4715,27 +4749,20 @@ void Character::recalculate_enchantment_cache()
         }
     } );
 
-
+    std::vector<std::pair<const enchantment *, bool>> sources;
     for( const bionic &bio : *my_bionics ) {
         const bionic_id &bid = bio.id;
-
+        const bool active = bio.powered && bid->has_flag( json_flag_BIONIC_TOGGLED );
         for( const enchantment_id &ench_id : bid->enchantments ) {
-            const enchantment &ench = ench_id.obj();
-            if( ench.is_active( *this, bio.powered &&
-                                bid->has_flag( json_flag_BIONIC_TOGGLED ) ) ) {
-                enchantment_cache->force_add( ench, *this );
-            }
+            sources.emplace_back( &ench_id.obj(), active );
         }
     }
-
     for( const auto &elem : *effects ) {
         for( const enchantment_id &ench_id : elem.first->enchantments ) {
-            const enchantment &ench = ench_id.obj();
-            if( ench.is_active( *this, true ) ) {
-                enchantment_cache->force_add( ench, *this );
-            }
+            sources.emplace_back( &ench_id.obj(), true );
         }
     }
+    add_enchantments( bionic_effect_enchantments, sources );
 
     for( const std::pair<const trait_id, trait_data> &mut_map : my_mutations ) {
         if( mut_map.second.corrupted == 0 ) {
@@ -4750,17 +4777,17 @@ void Character::recalculate_enchantment_cache()
     }
     new_mutation_cache->mutations = enchantment_cache->mutations;
     update_cached_mutations();
+    sources.clear();
     for( const std::pair<const trait_id, trait_data> &mut_map : cached_mutations ) {
         if( mut_map.second.corrupted == 0 ) {
             const mutation_branch &mut = mut_map.first.obj();
             for( const enchantment_id &ench_id : mut.enchantments ) {
-                const enchantment &ench = ench_id.obj();
-                if( ench.is_active( *this, mut.activated && mut_map.second.powered ) ) {
-                    enchantment_cache->force_add( ench, *this );
-                }
+                sources.emplace_back( &ench_id.obj(), mut.activated && mut_map.second.powered );
             }
         }
     }
+    add_enchantments( mutation_enchantments, sources );
+    enchantment_sources_dirty = false;
 
     if( enchantment_cache->modifies_bodyparts() ) {
         recalculate_bodyparts();
@@ -6701,8 +6728,9 @@ void Character::process_effects()
     }
 
     // Apply new effects from effect->effect chains
-    while( !scheduled_effects.empty() ) {
-        const scheduled_effect_t &effect = scheduled_effects.front();
+    // Adding an effect can schedule more, so copy each entry out before using it.
+    for( size_t i = 0; i < scheduled_effects.size(); ++i ) {
+        const scheduled_effect_t effect = scheduled_effects[i];
 
         add_effect( effect_source::empty(),
                     effect.eff_id,
@@ -6712,19 +6740,16 @@ void Character::process_effects()
                     effect.intensity,
                     effect.force,
                     effect.deferred );
-
-        scheduled_effects.pop();
     }
+    scheduled_effects.clear();
 
     // Perform immediate effect removals
-    while( !terminating_effects.empty() ) {
-
-        const terminating_effect_t &effect = terminating_effects.front();
+    for( size_t i = 0; i < terminating_effects.size(); ++i ) {
+        const terminating_effect_t effect = terminating_effects[i];
 
         remove_effect( effect.eff_id, effect.bp );
-
-        terminating_effects.pop();
     }
+    terminating_effects.clear();
 
     // Being stuck in tight spaces sucks. TODO: could be expanded to apply to non-vehicle conditions.
     if( will_be_cramped_in_vehicle_tile( here, pos_abs() ) ) {
@@ -54,6 +54,7 @@
 #include "stomach.h"
 #include "string_formatter.h"
 #include "subbodypart.h"
+#include "timer_wheel.h"
 #include "type_id.h"
 #include "units.h"
 #include "visitable.h"
@@ -72,6 +73,7 @@ class character_martial_arts;
 class dispersion_sources;
 class effect;
 class enchant_cache;
+class enchantment;
 class faction;
 class item_pocket;
 class known_magic;
@@ -307,71 +309,85 @@ struct queued_eoc {
         global_variables::impl_t context;
 };
 
-struct eoc_compare {
-    bool operator()( const queued_eoc &lhs, const queued_eoc &rhs ) const {
-        return lhs.time > rhs.time;
-    }
-};
-
 struct queued_eocs {
-    using storage_iter = std::list<queued_eoc>::iterator;
+    public:
+        using storage_iter = std::list<queued_eoc>::iterator;
 
-    struct eoc_compare : ::eoc_compare {
-        bool operator()( const storage_iter &lhs, const storage_iter &rhs ) const {
-            return ::eoc_compare::operator()( *lhs, *rhs );
+        // Stable storage, so the wheel can refer to entries by iterator.
+        std::list<queued_eoc> list;
+
+        queued_eocs() = default;
+
+        queued_eocs( const queued_eocs &rhs ) : list( rhs.list ) {
+            rebuild();
+        }
+        queued_eocs( queued_eocs &&rhs ) noexcept {
+            list.swap( rhs.list );
+            std::swap( wheel, rhs.wheel );
         }
-    };
-    std::priority_queue<storage_iter, std::vector<storage_iter>, eoc_compare> queue;
-    std::list<queued_eoc> list;
 
-    queued_eocs() = default;
+        queued_eocs &operator=( const queued_eocs &rhs ) {
+            list = rhs.list;
+            rebuild();
+            return *this;
+        }
+        queued_eocs &operator=( queued_eocs &&rhs ) noexcept {
+            list.swap( rhs.list );
+            std::swap( wheel, rhs.wheel );
+            return *this;
+        }
 
-    queued_eocs( const queued_eocs &rhs ) {
-        list = rhs.list;
-        for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-            queue.emplace( it );
+        bool empty() const {
+            return list.empty();
         }
-    };
-    queued_eocs( queued_eocs &&rhs ) noexcept {
-        queue.swap( rhs.queue );
-        list.swap( rhs.list );
-    }
 
-    queued_eocs &operator=( const queued_eocs &rhs ) {
-        list = rhs.list;
-        // Why doesn't std::priority_queue have a clear() function.
-        queue = {};
-        for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-            queue.emplace( it );
+        void push( const queued_eoc &eoc ) {
+            auto it = list.emplace( list.end(), eoc );
+            wheel.insert( to_turn<std::int64_t>( eoc.time ), it );
         }
-        return *this;
-    }
-    queued_eocs &operator=( queued_eocs &&rhs ) noexcept {
-        queue.swap( rhs.queue );
-        list.swap( rhs.list );
-        return *this;
-    }
 
-    /* std::priority_queue compatibility layer where performance is less relevant */
+        /** Takes every entry due by @p now out of the schedule and appends it to @p out, earliest
+         * first.  The entries stay in @ref list until they are erased or rescheduled. */
+        void take_due( const time_point &now, std::vector<storage_iter> &out ) {
+            wheel.advance( to_turn<std::int64_t>( now ), out );
+        }
+        /** Puts an entry returned by @ref take_due back into the schedule at its (new) time. */
+        void reschedule( storage_iter it ) {
+            wheel.insert( to_turn<std::int64_t>( it->time ), it );
+        }
+        /** Drops an entry returned by @ref take_due. */
+        void erase( storage_iter it ) {
+            list.erase( it );
+        }
 
-    bool empty() const {
-        return queue.empty();
-    }
+        void clear() {
+            list.clear();
+            wheel.clear();
+        }
 
-    const queued_eoc &top() const {
-        return *queue.top();
-    }
+        /** All queued entries, earliest first. */
+        std::vector<const queued_eoc *> sorted() const {
+            std::vector<const queued_eoc *> ret;
+            ret.reserve( list.size() );
+            for( const queued_eoc &eoc : list ) {
+                ret.push_back( &eoc );
+            }
+            std::stable_sort( ret.begin(), ret.end(),
+            []( const queued_eoc * lhs, const queued_eoc * rhs ) {
+                return lhs->time < rhs->time;
+            } );
+            return ret;
+        }
 
-    void push( const queued_eoc &eoc ) {
-        auto it = list.emplace( list.end(), eoc );
-        queue.push( it );
-    }
+    private:
+        timer_wheel<storage_iter> wheel;
 
-    void pop() {
-        auto it = queue.top();
-        queue.pop();
-        list.erase( it );
-    }
+        void rebuild() {
+            wheel.clear();
+            for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
+                wheel.insert( to_turn<std::int64_t>( it->time ), it );
+            }
+        }
 };
 
 struct aim_type {
@@ -1624,6 +1640,9 @@ class Character : public Creature, public visitable
         void recalculate_bodyparts();
         // recalculates enchantment cache by iterating through all held, worn, and wielded items
         void recalculate_enchantment_cache();
+        // Same as recalculate_enchantment_cache(), except that the static enchantments of
+        // bionics, effects and mutations are only summed up again when those change.
+        void update_enchantment_cache();
         // gets add and mult value from enchantment cache
 
         /** Returns true if the player has any martial arts buffs attached */
@@ -3465,6 +3484,8 @@ class Character : public Creature, public visitable
         void vitamins_mod( const std::map<vitamin_id, int> & );
         /** Get vitamin usage rate (minutes per unit) accounting for bionics, mutations and effects */
         time_duration vitamin_rate( const vitamin_id &vit ) const;
+        /** Same as @ref vitamin_rate for every vitamin at once, in the order of vitamin::all() */
+        std::vector<time_duration> vitamin_rates() const;
         /** Modify vitamin intake (e.g. due to effects) */
         std::map<vitamin_id, int> effect_vitamin_mod( const std::map<vitamin_id, int> & );
         /** Remove all vitamins */
@@ -4288,6 +4309,18 @@ class Character : public Creature, public visitable
         pimpl<enchant_cache> new_mutation_cache;
 
     private:
+        // Enchantments of bionics, effects or mutations together with whether their source is
+        // active, and the sum of the static ones among them (see enchantment::is_static()).
+        struct enchantment_sources {
+            std::vector<std::pair<const enchantment *, bool>> sources;
+            pimpl<enchant_cache> static_sum;
+        };
+        void add_enchantments( enchantment_sources &cached,
+                               std::vector<std::pair<const enchantment *, bool>> &sources );
+        enchantment_sources bionic_effect_enchantments;
+        enchantment_sources mutation_enchantments;
+        bool enchantment_sources_dirty = true;
+
         /* cached recipes, which are invalidated if the turn changes */
         mutable time_point cached_recipe_turn;
         pimpl<recipe_subset> cached_recipe_subset;
@@ -1206,13 +1206,14 @@ units::mass outfit::weight_carried_with_tweaks( const std::map<const item *, int
         if( without.empty() ) {
             ret += i.weight();
         } else if( !without.count( &i ) ) {
-            for( const item *j : i.all_items_ptr( pocket_type::CONTAINER ) ) {
-                if( j->count_by_charges() ) {
-                    ret -= get_selected_stack_weight( j, without );
-                } else if( without.count( j ) ) {
-                    ret -= j->weight();
+            i.visit_items_top_recursive( pocket_type::CONTAINER,
+            [&ret, &without]( const item & j ) {
+                if( j.count_by_charges() ) {
+                    ret -= get_selected_stack_weight( &j, without );
+                } else if( without.count( &j ) ) {
+                    ret -= j.weight();
                 }
-            }
+            } );
             ret += i.weight();
         }
     }
@@ -126,6 +126,11 @@ static const trait_id trait_URSINE_FUR( "URSINE_FUR" );
 
 static const vitamin_id vitamin_blood( "blood" );
 
+static const var_key var_got_to_half_stam( "got_to_half_stam" );
+static const var_key var_quarter_stam_counter( "quarter_stam_counter" );
+static const var_key var_sleep_health_mult( "sleep_health_mult" );
+static const var_key var_was_sleeping( "was_sleeping" );
+
 void Character::update_body_wetness( const w_point &weather )
 {
     // Average number of turns to go from completely soaked to fully dry
@@ -252,7 +257,7 @@ void Character::update_body( const time_point &from, const time_point &to )
         oxygen = std::min( oxygen, get_oxygen_max() );
     }
     update_stomach( from, to );
-    recalculate_enchantment_cache();
+    update_enchantment_cache();
     if( ticks_between( from, to, 3_minutes ) > 0 ) {
         magic->update_mana( *this, to_turns<float>( 3_minutes ) );
     }
@@ -271,7 +276,7 @@ void Character::update_body( const time_point &from, const time_point &to )
         mend( five_mins * to_turns<int>( 5_minutes ) );
         activity_history.reset_activity_level();
     }
-    bool was_sleeping = get_value( "was_sleeping" ).str() == "true";
+    bool was_sleeping = get_value( var_was_sleeping ).str() == "true";
     if( in_sleep_state() && was_sleeping ) {
         needs_rates tmp_rates;
         calc_sleep_recovery_rate( tmp_rates );
@@ -282,32 +287,32 @@ void Character::update_body( const time_point &from, const time_point &to )
     }
     if( was_sleeping && !in_sleep_state() ) {
         if( get_continuous_sleep() >= 6_hours ) {
-            set_value( "sleep_health_mult", 2 );
+            set_value( var_sleep_health_mult, 2 );
         }
         reset_continuous_sleep();
     }
     if( calendar::once_every( 12_hours ) ) {
-        const int sleep_health_mult = get_value( "sleep_health_mult" ).dbl();
+        const int sleep_health_mult = get_value( var_sleep_health_mult ).dbl();
         mod_daily_health( sleep_health_mult * to_hours<int>( get_daily_sleep() ), 10 );
-        set_value( "sleep_health_mult", 1 );
+        set_value( var_sleep_health_mult, 1 );
     }
     if( calendar::once_every( 1_days ) ) {
         reset_daily_sleep();
     }
-    set_value( "was_sleeping", in_sleep_state() ? "true" : "false" );
+    set_value( var_was_sleeping, in_sleep_state() ? "true" : "false" );
 
     activity_history.new_turn( in_sleep_state() );
 
     // Cardio related health stuff
     if( calendar::once_every( 1_days ) ) {
         // not getting below half stamina even once in a whole day is not healthy
-        if( get_value( "got_to_half_stam" ).is_empty() ) {
+        if( get_value( var_got_to_half_stam ).is_empty() ) {
             mod_daily_health( -4, -200 );
         } else {
-            remove_value( "got_to_half_stam" );
+            remove_value( var_got_to_half_stam );
         }
         // reset counter for number of time going below quarter stamina
-        set_value( "quarter_stam_counter", 0 );
+        set_value( var_quarter_stam_counter, 0 );
 
         int cardio_accumultor = get_cardio_acc();
         if( cardio_accumultor > 0 ) {
@@ -327,8 +332,11 @@ void Character::update_body( const time_point &from, const time_point &to )
         }
     }
 
+    const std::vector<time_duration> rates = vitamin_rates();
+    const bool daily_vitamin_check = calendar::once_every( 24_hours );
+    auto rate_iter = rates.begin();
     for( const auto &v : vitamin::all() ) {
-        const time_duration rate = vitamin_rate( v.first );
+        const time_duration rate = *rate_iter++;
 
         // No blood volume regeneration if body lacks fluids
         if( v.first == vitamin_blood && has_effect( effect_hypovolemia ) && get_thirst() > 240 ) {
@@ -348,7 +356,7 @@ void Character::update_body( const time_point &from, const time_point &to )
                 vitamin_mod( v.first, qty );
             }
         }
-        if( calendar::once_every( 24_hours ) && v.first->type() == vitamin_type::VITAMIN ) {
+        if( daily_vitamin_check && v.first->type() == vitamin_type::VITAMIN ) {
             const int &vit_quantity = get_daily_vitamin( v.first, true );
             const int RDA = vitamin_RDA( v.first, vit_quantity );
             if( RDA >= 50 ) {
@@ -219,6 +219,9 @@ static const trait_id trait_WATERSLEEP( "WATERSLEEP" );
 static const vitamin_id vitamin_calcium( "calcium" );
 static const vitamin_id vitamin_iron( "iron" );
 
+static const var_key var_got_to_half_stam( "got_to_half_stam" );
+static const var_key var_quarter_stam_counter( "quarter_stam_counter" );
+
 namespace io
 {
 
@@ -2160,15 +2163,15 @@ void Character::mod_stamina( int mod )
     float quarter_thresh = 0.25 * get_stamina_max();
     float half_thresh = 0.5 * get_stamina_max();
 
-    int quarter_stam_counter = get_value( "quarter_stam_counter" ).dbl();
+    int quarter_stam_counter = get_value( var_quarter_stam_counter ).dbl();
 
     if( stamina > half_thresh && stamina + mod < half_thresh ) {
-        set_value( "got_to_half_stam", "true" );
+        set_value( var_got_to_half_stam, "true" );
     }
 
     if( stamina > quarter_thresh && stamina + mod < quarter_thresh && quarter_stam_counter < 5 ) {
         quarter_stam_counter++;
-        set_value( "quarter_stam_counter", quarter_stam_counter );
+        set_value( var_quarter_stam_counter, quarter_stam_counter );
         mod_daily_health( 1, 5 );
     }
 
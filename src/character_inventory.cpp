@@ -1139,13 +1139,14 @@ units::mass Character::weight_carried_with_tweaks( const item_tweaks &tweaks ) c
     units::mass weaponweight = 0_gram;
     if( !without.count( &weapon ) ) {
         weaponweight += weapon.weight();
-        for( const item *i : weapon.all_items_ptr( pocket_type::CONTAINER ) ) {
-            if( i->count_by_charges() ) {
-                weaponweight -= get_selected_stack_weight( i, without );
-            } else if( without.count( i ) ) {
-                weaponweight -= i->weight();
+        weapon.visit_items_top_recursive( pocket_type::CONTAINER, [&weaponweight,
+        &without]( const item & i ) {
+            if( i.count_by_charges() ) {
+                weaponweight -= get_selected_stack_weight( &i, without );
+            } else if( without.count( &i ) ) {
+                weaponweight -= i.weight();
             }
-        }
+        } );
     } else if( weapon.count_by_charges() ) {
         weaponweight += weapon.weight() - get_selected_stack_weight( &weapon, without );
     }
@@ -127,17 +127,17 @@ void computer::set_mission( const int id )
 }
 
 // Methods for setting/getting misc key/value pairs.
-void computer::set_value( const std::string &key, diag_value value )
+void computer::set_value( const var_key &key, diag_value value )
 {
     values[ key ] = std::move( value );
 }
 
-void computer::remove_value( const std::string &key )
+void computer::remove_value( const var_key &key )
 {
     values.erase( key );
 }
 
-diag_value const *computer::maybe_get_value( const std::string &key ) const
+diag_value const *computer::maybe_get_value( const var_key &key ) const
 {
     return global_variables::_common_maybe_get_value( key, values );
 }
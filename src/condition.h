@@ -51,13 +51,13 @@ duration_or_var get_duration_or_var( const JsonObject &jo, std::string_view memb
                                      time_duration default_val = 0_seconds );
 // DEPRECATED. use mandatory/optional, deserialize, or JsonValue::read
 var_info read_var_info( const JsonObject &jo );
-void write_var_value( var_type type, const std::string &name, dialogue *d,
+void write_var_value( var_type type, const var_key &name, dialogue *d,
                       const std::string &value );
-void write_var_value( var_type type, const std::string &name, dialogue *d,
+void write_var_value( var_type type, const var_key &name, dialogue *d,
                       double value );
-void write_var_value( var_type type, const std::string &name, dialogue *d,
+void write_var_value( var_type type, const var_key &name, dialogue *d,
                       const tripoint_abs_ms &value );
-void write_var_value( var_type type, const std::string &name, dialogue *d,
+void write_var_value( var_type type, const var_key &name, dialogue *d,
                       const diag_value &value );
 std::string get_talk_varname( const JsonObject &jo, std::string_view member );
 std::string get_talk_var_basename( const JsonObject &jo, std::string_view member,
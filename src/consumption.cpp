@@ -609,6 +609,20 @@ std::pair<int, int> Character::fun_for( const item &comest, bool ignore_already_
     return { static_cast< int >( fun ), static_cast< int >( fun_max ) };
 }
 
+// Combines the rate a mutation gives a vitamin with the rate so far.
+static void add_vitamin_rate( time_duration &res, const time_duration &mut_rate )
+{
+    if( mut_rate == 0_turns ) {
+        return;
+    }
+    if( res != 0_turns ) {
+        const float recip_vit = 1 / to_turns<float>( res ) + 1 / to_turns<float>( mut_rate );
+        res = recip_vit == 0 ? 0_turns : time_duration::from_turns( 1 / recip_vit );
+    } else {
+        res = mut_rate;
+    }
+}
+
 time_duration Character::vitamin_rate( const vitamin_id &vit ) const
 {
     time_duration res = vit.obj().rate();
@@ -616,12 +630,37 @@ time_duration Character::vitamin_rate( const vitamin_id &vit ) const
     for( const auto &m : get_functioning_mutations() ) {
         const mutation_branch &mut = m.obj();
         auto iter = mut.vitamin_rates.find( vit );
-        if( iter != mut.vitamin_rates.end() && iter->second != 0_turns ) {
-            if( res != 0_turns ) {
-                const float recip_vit = 1 / to_turns<float>( res ) + 1 / to_turns<float>( iter->second );
-                res = recip_vit == 0 ? 0_turns : time_duration::from_turns( 1 / recip_vit );
-            } else {
-                res = iter->second;
+        if( iter != mut.vitamin_rates.end() ) {
+            add_vitamin_rate( res, iter->second );
+        }
+    }
+
+    return res;
+}
+
+std::vector<time_duration> Character::vitamin_rates() const
+{
+    const std::map<vitamin_id, vitamin> &all = vitamin::all();
+    std::vector<time_duration> res;
+    res.reserve( all.size() );
+    for( const std::pair<const vitamin_id, vitamin> &v : all ) {
+        res.push_back( v.second.rate() );
+    }
+
+    for( const trait_id &m : get_functioning_mutations() ) {
+        const std::map<vitamin_id, time_duration> &mut_rates = m->vitamin_rates;
+        if( mut_rates.empty() ) {
+            continue;
+        }
+        // Both maps are sorted the same way, walk them side by side.
+        auto mut_iter = mut_rates.begin();
+        auto vit_iter = all.begin();
+        for( size_t i = 0; vit_iter != all.end() && mut_iter != mut_rates.end(); ++vit_iter, ++i ) {
+            while( mut_iter != mut_rates.end() && mut_iter->first < vit_iter->first ) {
+                ++mut_iter;
+            }
+            if( mut_iter != mut_rates.end() && mut_iter->first == vit_iter->first ) {
+                add_vitamin_rate( res[i], mut_iter->second );
             }
         }
     }
@@ -579,8 +579,17 @@ bool Creature::sees( const map &here, const Creature &critter ) const
     }
 
     // If we cannot see without any of the penalties below, bail now.
-    if( !sees( here, critter_pos, critter.is_avatar() ) ) {
-        return false;
+    // Whenever the avatar is involved this goes through its vision cache, which also applies
+    // its stealth to whoever looks at it. Only pairs of other creatures use the map's matrix.
+    if( is_avatar() || critter.is_avatar() ) {
+        if( !sees( here, critter_pos, critter.is_avatar() ) ) {
+            return false;
+        }
+    } else {
+        const int range = vision_range_to( here, critter_pos );
+        if( range < 0 || !here.sees_between( *this, critter, range ) ) {
+            return false;
+        }
     }
 
     // Used with the Mind over Matter power Obscurity, to telepathically erase yourself from a target's perceptions
@@ -659,20 +668,18 @@ bool Creature::sees( const map &here, const Creature &critter ) const
     return visible( ch );
 }
 
-bool Creature::sees( const map &here, const tripoint_bub_ms &t, bool is_avatar,
-                     int range_mod ) const
+int Creature::vision_range_to( const map &here, const tripoint_bub_ms &t, int range_mod ) const
 {
     if( std::abs( posz() - t.z() ) > fov_3d_z_range ) {
-        return false;
+        return -1;
     }
 
-    const tripoint_bub_ms pos = pos_bub( here );
     const int range_cur = sight_range( here.ambient_light_at( t ) );
     const int range_day = sight_range( default_daylight_level() );
     const int range_night = sight_range( 0 );
     const int range_max = std::max( range_day, range_night );
     const int range_min = std::min( range_cur, range_max );
-    const int wanted_range = rl_dist( pos, t );
+    const int wanted_range = rl_dist( pos_bub( here ), t );
     if( wanted_range <= range_min ||
         ( wanted_range <= range_max &&
           here.ambient_light_at( t ) > here.get_cache_ref( t.z() ).natural_light_level_cache ) ) {
@@ -688,18 +695,28 @@ bool Creature::sees( const map &here, const tripoint_bub_ms &t, bool is_avatar,
         if( range_mod > 0 ) {
             range = std::min( range, range_mod );
         }
-        if( is_avatar ) {
-            // Special case monster -> player visibility, forcing it to be symmetric with player vision.
-            const float player_visibility_factor = get_player_character().visibility() / 100.0f;
-            int adj_range = std::floor( range * player_visibility_factor );
-            return adj_range >= wanted_range &&
-                   here.get_cache_ref( posz() ).seen_cache[pos.x()][pos.y()] > LIGHT_TRANSPARENCY_SOLID;
-        } else {
-            return here.sees( pos, t, range );
-        }
-    } else {
+        return range;
+    }
+    return -1;
+}
+
+bool Creature::sees( const map &here, const tripoint_bub_ms &t, bool is_avatar,
+                     int range_mod ) const
+{
+    const int range = vision_range_to( here, t, range_mod );
+    if( range < 0 ) {
         return false;
     }
+    const tripoint_bub_ms pos = pos_bub( here );
+    if( is_avatar ) {
+        // Special case monster -> player visibility, forcing it to be symmetric with player vision.
+        const float player_visibility_factor = get_player_character().visibility() / 100.0f;
+        int adj_range = std::floor( range * player_visibility_factor );
+        return adj_range >= rl_dist( pos, t ) &&
+               here.get_cache_ref( posz() ).seen_cache[pos.x()][pos.y()] > LIGHT_TRANSPARENCY_SOLID;
+    } else {
+        return here.sees( pos, t, range );
+    }
 }
 
 // Helper function to check if potential area of effect of a weapon overlaps vehicle
@@ -1880,23 +1897,23 @@ void Creature::add_effect( const effect_source &source, const efftype_id &eff_id
 
 void Creature::schedule_effect( const effect &eff, bool force, bool deferred )
 {
-    scheduled_effects.push( scheduled_effect{eff.get_id(), eff.get_duration(), eff.get_bp(),
-                            eff.is_permanent(), eff.get_intensity(), force,
-                            deferred} );
+    scheduled_effects.push_back( scheduled_effect{eff.get_id(), eff.get_duration(), eff.get_bp(),
+                                 eff.is_permanent(), eff.get_intensity(), force,
+                                 deferred} );
 }
 void Creature::schedule_effect( const efftype_id &eff_id, const time_duration &dur, bodypart_id bp,
                                 bool permanent, int intensity, bool force, bool deferred )
 {
-    scheduled_effects.push( scheduled_effect{eff_id, dur, bp,
-                            permanent, intensity, force,
-                            deferred} );
+    scheduled_effects.push_back( scheduled_effect{eff_id, dur, bp,
+                                 permanent, intensity, force,
+                                 deferred} );
 }
 void Creature::schedule_effect( const efftype_id &eff_id,
                                 const time_duration &dur, bool permanent, int intensity, bool force,
                                 bool deferred )
 {
-    scheduled_effects.push( scheduled_effect{eff_id, dur, bodypart_str_id::NULL_ID(),
-                            permanent, intensity, force, deferred} );
+    scheduled_effects.push_back( scheduled_effect{eff_id, dur, bodypart_str_id::NULL_ID(),
+                                 permanent, intensity, force, deferred} );
 }
 
 bool Creature::add_env_effect( const efftype_id &eff_id, const bodypart_id &vector, int strength,
@@ -1974,7 +1991,7 @@ bool Creature::remove_effect( const efftype_id &eff_id )
 
 void Creature::schedule_effect_removal( const efftype_id &eff_id, const bodypart_id &bp )
 {
-    terminating_effects.push( terminating_effect{eff_id, bp} );
+    terminating_effects.push_back( terminating_effect{eff_id, bp} );
 }
 void Creature::schedule_effect_removal( const efftype_id &eff_id )
 {
@@ -1983,6 +2000,9 @@ void Creature::schedule_effect_removal( const efftype_id &eff_id )
 
 bool Creature::has_effect( const efftype_id &eff_id, const bodypart_id &bp ) const
 {
+    if( !effects->might_have( eff_id ) ) {
+        return false;
+    }
     // bp_null means anything targeted or not
     if( bp.id() == bodypart_str_id::NULL_ID() ) {
         return effects->count( eff_id );
@@ -2065,6 +2085,9 @@ effect &Creature::get_effect( const efftype_id &eff_id, const bodypart_id &bp )
 
 const effect &Creature::get_effect( const efftype_id &eff_id, const bodypart_id &bp ) const
 {
+    if( !effects->might_have( eff_id ) ) {
+        return effect::null_effect;
+    }
     auto got_outer = effects->find( eff_id );
     if( got_outer != effects->end() ) {
         auto got_inner = got_outer->second.find( bp );
@@ -2103,11 +2126,11 @@ void Creature::process_effects()
     std::vector<bodypart_id> rem_bps;
 
     // Decay/removal of effects
+    const bool frozen = has_flag( json_flag_FREEZE_EFFECTS );
     for( auto &elem : *effects ) {
         for( auto &_it : elem.second ) {
             // Do not freeze the effect with the FREEZE_EFFECTS flag.
-            if( has_flag( json_flag_FREEZE_EFFECTS ) &&
-                !_it.second.has_flag( json_flag_FREEZE_EFFECTS ) ) {
+            if( frozen && !_it.second.has_flag( json_flag_FREEZE_EFFECTS ) ) {
                 continue;
             }
             // Add any effects that others remove to the removal list
@@ -2167,22 +2190,22 @@ bool Creature::has_trait( const trait_id &/*flag*/ ) const
 }
 
 // Methods for setting/getting misc key/value pairs.
-void Creature::set_value( const std::string &key, diag_value value )
+void Creature::set_value( const var_key &key, diag_value value )
 {
     values[ key ] = std::move( value );
 }
 
-void Creature::remove_value( const std::string &key )
+void Creature::remove_value( const var_key &key )
 {
     values.erase( key );
 }
 
-diag_value const &Creature::get_value( const std::string &key ) const
+diag_value const &Creature::get_value( const var_key &key ) const
 {
     return global_variables::_common_get_value( key, values );
 }
 
-diag_value const *Creature::maybe_get_value( const std::string &key ) const
+diag_value const *Creature::maybe_get_value( const var_key &key ) const
 {
     return global_variables::_common_maybe_get_value( key, values );
 }
@@ -405,6 +405,11 @@ class Creature : public viewer
         bool sees( const map &here, const tripoint_bub_ms &t, bool is_avatar = false,
                    int range_mod = 0 ) const override;
         /*@}*/
+        /**
+         * How far this creature can see towards `t` given the light there, or -1 if `t` is too
+         * dark or too far away to be seen at all.
+         */
+        int vision_range_to( const map &here, const tripoint_bub_ms &t, int range_mod = 0 ) const;
 
         /**
          * How far the creature sees under the given light. Creature cannot see places outside this range.
@@ -699,14 +704,14 @@ class Creature : public viewer
         bool resists_effect( const effect &e ) const;
 
         // Methods for setting/getting misc key/value pairs.
-        void set_value( const std::string &key, diag_value value );
+        void set_value( const var_key &key, diag_value value );
         template <typename... Args>
-        void set_value( const std::string &key, Args... args ) {
+        void set_value( const var_key &key, Args... args ) {
             set_value( key, diag_value{ std::forward<Args>( args )... } );
         }
-        void remove_value( const std::string &key );
-        diag_value const &get_value( const std::string &key ) const;
-        diag_value const *maybe_get_value( const std::string &key ) const;
+        void remove_value( const var_key &key );
+        diag_value const &get_value( const var_key &key ) const;
+        diag_value const *maybe_get_value( const var_key &key ) const;
         void clear_values();
 
         virtual units::mass get_weight() const = 0;
@@ -1241,8 +1246,9 @@ class Creature : public viewer
         virtual void process_one_effect( effect &e, bool is_new ) = 0;
 
         pimpl<effects_map> effects;
-        std::queue<scheduled_effect, std::list<scheduled_effect>> scheduled_effects;
-        std::queue<terminating_effect, std::list<terminating_effect>> terminating_effects;
+        // Drained in order once per turn, entries added while draining are handled as well.
+        std::vector<scheduled_effect> scheduled_effects;
+        std::vector<terminating_effect> terminating_effects;
 
         std::vector<damage_over_time_data> damage_over_time_map;
 
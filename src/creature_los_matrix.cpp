@@ -0,0 +1,83 @@
+#include "creature_los_matrix.h"
+
+#include <algorithm>
+
+int creature_los_matrix::slot( const Creature &critter, const tripoint_abs_ms &pos )
+{
+    const auto found = slots.find( &critter );
+    if( found != slots.end() ) {
+        if( positions[found->second] != pos ) {
+            forget( found->second );
+            positions[found->second] = pos;
+        }
+        return found->second;
+    }
+    const int next = static_cast<int>( positions.size() );
+    if( next >= max_slots ) {
+        return -1;
+    }
+    if( next >= words_per_row * 64 ) {
+        reserve( std::max( 64, words_per_row * 128 ) );
+    }
+    slots.emplace( &critter, next );
+    positions.push_back( pos );
+    return next;
+}
+
+std::optional<bool> creature_los_matrix::get( int a, int b ) const
+{
+    if( !test( known, a, b ) ) {
+        return std::nullopt;
+    }
+    return test( visible, a, b );
+}
+
+void creature_los_matrix::set( int a, int b, bool is_visible )
+{
+    assign( known, a, b, true );
+    assign( known, b, a, true );
+    assign( visible, a, b, is_visible );
+    assign( visible, b, a, is_visible );
+}
+
+void creature_los_matrix::clear()
+{
+    // Keep the storage around, the matrix is refilled every turn.  Rows past the used ones
+    // are still clear.
+    std::fill_n( known.begin(), positions.size() * words_per_row, 0 );
+    slots.clear();
+    positions.clear();
+}
+
+void creature_los_matrix::assign( std::vector<std::uint64_t> &bits, int a, int b, bool value )
+{
+    const std::uint64_t mask = std::uint64_t{ 1 } << ( b % 64 );
+    std::uint64_t &word = bits[a * words_per_row + b / 64];
+    word = value ? word | mask : word & ~mask;
+}
+
+void creature_los_matrix::forget( int slot )
+{
+    std::fill_n( known.begin() + slot * words_per_row, words_per_row, 0 );
+    const int count = static_cast<int>( positions.size() );
+    for( int other = 0; other < count; ++other ) {
+        assign( known, other, slot, false );
+    }
+}
+
+void creature_los_matrix::reserve( int new_slots )
+{
+    const int new_words = ( new_slots + 63 ) / 64;
+    std::vector<std::uint64_t> new_known( static_cast<std::size_t>( new_slots ) * new_words );
+    std::vector<std::uint64_t> new_visible( new_known.size() );
+    const int rows = static_cast<int>( positions.size() );
+    for( int row = 0; row < rows; ++row ) {
+        std::copy_n( known.begin() + row * words_per_row, words_per_row,
+                     new_known.begin() + row * new_words );
+        std::copy_n( visible.begin() + row * words_per_row, words_per_row,
+                     new_visible.begin() + row * new_words );
+    }
+    known = std::move( new_known );
+    visible = std::move( new_visible );
+    words_per_row = new_words;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#ifndef CATA_SRC_CREATURE_LOS_MATRIX_H
+#define CATA_SRC_CREATURE_LOS_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "coordinates.h"
+
+class Creature;
+
+/**
+ * Line of sight between pairs of creatures, filled in as creatures ask about each other.
+ *
+ * Every creature that takes part in a query gets a row and a column of a bit matrix, one bit
+ * saying whether the pair has been checked and one whether they can see each other.  The bits
+ * describe the positions the creatures had when the pair was checked: when a creature shows up
+ * somewhere else its row and column are forgotten.  That also makes it harmless if a creature
+ * is destroyed and a new one takes over its address.
+ *
+ * Line of sight is symmetric here, same as in the map's skew vision cache.  The matrix does not
+ * notice terrain changes, the map resets it whenever it rebuilds its caches.
+ */
+class creature_los_matrix
+{
+    public:
+        /** Row of the creature standing at pos, -1 once the matrix is full. */
+        int slot( const Creature &critter, const tripoint_abs_ms &pos );
+        std::optional<bool> get( int a, int b ) const;
+        void set( int a, int b, bool visible );
+        void clear();
+
+        // Creatures beyond that go through the map's regular cache
+        static constexpr int max_slots = 1024;
+
+    private:
+        bool test( const std::vector<std::uint64_t> &bits, int a, int b ) const {
+            return bits[a * words_per_row + b / 64] & ( std::uint64_t{ 1 } << ( b % 64 ) );
+        }
+        void assign( std::vector<std::uint64_t> &bits, int a, int b, bool value );
+        void forget( int slot );
+        void reserve( int new_slots );
+
+        std::unordered_map<const Creature *, int> slots;
+        std::vector<tripoint_abs_ms> positions;
+        int words_per_row = 0;
+        std::vector<std::uint64_t> known;
+        std::vector<std::uint64_t> visible;
+};
+
+#endif // CATA_SRC_CREATURE_LOS_MATRIX_H
@@ -9,10 +9,12 @@
 
 #include "avatar.h"
 #include "cata_assert.h"
+#include "cata_utility.h"
 #include "debug.h"
 #include "flood_fill.h"
 #include "game.h"
 #include "map.h"
+#include "map_scale_constants.h"
 #include "mapdata.h"
 #include "maptile_fwd.h"
 #include "mongroup.h"
@@ -93,7 +95,7 @@ bool creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
     }
 
     monsters_list.emplace_back( critter_ptr );
-    monsters_by_location[critter.pos_abs()] = critter_ptr;
+    set_location( critter.pos_abs(), critter_ptr );
     return true;
 }
 
@@ -130,8 +132,8 @@ bool creature_tracker::update_pos( const monster &critter, const tripoint_abs_ms
         return ptr.get() == &critter;
     } );
     if( iter != monsters_list.end() ) {
-        monsters_by_location.erase( old_pos );
-        monsters_by_location[new_pos] = *iter;
+        erase_location( old_pos );
+        set_location( new_pos, *iter );
         return true;
     } else {
         // We're changing the x/y/z coordinates of a zombie that hasn't been added
@@ -148,7 +150,7 @@ void creature_tracker::remove_from_location_map( const monster &critter )
 {
     const auto pos_iter = monsters_by_location.find( critter.pos_abs() );
     if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
-        monsters_by_location.erase( pos_iter );
+        erase_location( critter.pos_abs() );
         return;
     }
 
@@ -159,7 +161,127 @@ void creature_tracker::remove_from_location_map( const monster &critter )
         return v.second.get() == &critter;
     } );
     if( iter != monsters_by_location.end() ) {
-        monsters_by_location.erase( iter );
+        const tripoint_abs_ms pos = iter->first;
+        erase_location( pos );
+    }
+}
+
+void creature_tracker::set_location( const tripoint_abs_ms &pos,
+                                     const shared_ptr_fast<monster> &critter )
+{
+    monsters_by_location[pos] = critter;
+    std::vector<std::pair<tripoint_abs_ms, monster *>> &cell = monster_grid[grid_cell( pos )];
+    for( std::pair<tripoint_abs_ms, monster *> &entry : cell ) {
+        if( entry.first == pos ) {
+            entry.second = critter.get();
+            return;
+        }
+    }
+    cell.emplace_back( pos, critter.get() );
+}
+
+void creature_tracker::erase_location( const tripoint_abs_ms &pos )
+{
+    if( monsters_by_location.erase( pos ) == 0 ) {
+        return;
+    }
+    const auto cell = monster_grid.find( grid_cell( pos ) );
+    if( cell == monster_grid.end() ) {
+        return;
+    }
+    std::vector<std::pair<tripoint_abs_ms, monster *>> &entries = cell->second;
+    for( std::pair<tripoint_abs_ms, monster *> &entry : entries ) {
+        if( entry.first == pos ) {
+            entry = entries.back();
+            entries.pop_back();
+            break;
+        }
+    }
+    if( entries.empty() ) {
+        monster_grid.erase( cell );
+    }
+}
+
+void creature_tracker::clear_locations()
+{
+    monsters_by_location.clear();
+    monster_grid.clear();
+}
+
+tripoint creature_tracker::grid_cell( const tripoint_abs_ms &pos )
+{
+    return tripoint( divide_round_down( pos.x(), grid_size ),
+                     divide_round_down( pos.y(), grid_size ),
+                     pos.z() );
+}
+
+mfaction_id creature_tracker::faction_of( const monster &critter )
+{
+    return critter.get_monster_faction();
+}
+
+bool creature_tracker::is_dead( const monster &critter )
+{
+    return critter.is_dead();
+}
+
+void creature_tracker::monsters_in_radius( const tripoint_abs_ms &center, int radius,
+        std::vector<monster *> &out ) const
+{
+    if( radius < 0 || monster_grid.empty() ) {
+        return;
+    }
+    const tripoint low = grid_cell( center - tripoint( radius, radius, 0 ) );
+    const tripoint high = grid_cell( center + tripoint( radius, radius, 0 ) );
+    const int min_z = std::max( center.z() - radius, -OVERMAP_DEPTH );
+    const int max_z = std::min( center.z() + radius, OVERMAP_HEIGHT );
+
+    const auto add_from = [&]( const std::vector<std::pair<tripoint_abs_ms, monster *>> &cell ) {
+        for( const std::pair<tripoint_abs_ms, monster *> &entry : cell ) {
+            if( square_dist( center, entry.first ) <= radius && !entry.second->is_dead() ) {
+                out.push_back( entry.second );
+            }
+        }
+    };
+    const std::size_t cells_in_range = static_cast<std::size_t>( high.x - low.x + 1 ) *
+                                       ( high.y - low.y + 1 ) * ( max_z - min_z + 1 );
+    if( cells_in_range > monster_grid.size() ) {
+        // Huge radius, walking the occupied cells is cheaper than probing empty ones.
+        for( const auto &cell : monster_grid ) {
+            const tripoint &c = cell.first;
+            if( c.x >= low.x && c.x <= high.x && c.y >= low.y && c.y <= high.y &&
+                c.z >= min_z && c.z <= max_z ) {
+                add_from( cell.second );
+            }
+        }
+        return;
+    }
+    for( int z = min_z; z <= max_z; ++z ) {
+        for( int y = low.y; y <= high.y; ++y ) {
+            for( int x = low.x; x <= high.x; ++x ) {
+                const auto cell = monster_grid.find( tripoint( x, y, z ) );
+                if( cell != monster_grid.end() ) {
+                    add_from( cell->second );
+                }
+            }
+        }
+    }
+}
+
+void creature_tracker::creatures_in_radius( const tripoint_abs_ms &center, int radius,
+        std::vector<Creature *> &out ) const
+{
+    std::vector<monster *> monsters;
+    monsters_in_radius( center, radius, monsters );
+    out.insert( out.end(), monsters.begin(), monsters.end() );
+    for( const shared_ptr_fast<npc> &guy : active_npc ) {
+        if( !guy->is_dead() && square_dist( center, guy->pos_abs() ) <= radius ) {
+            out.push_back( guy.get() );
+        }
+    }
+    avatar &you = get_avatar();
+    if( square_dist( center, you.pos_abs() ) <= radius ) {
+        out.push_back( &you );
     }
 }
 
@@ -182,7 +304,7 @@ void creature_tracker::remove( const monster &critter )
 void creature_tracker::clear()
 {
     monsters_list.clear();
-    monsters_by_location.clear();
+    clear_locations();
     removed_this_turn_.clear();
     creatures_by_zone_and_faction_.clear();
     invalidate_reachability_cache();
@@ -190,9 +312,9 @@ void creature_tracker::clear()
 
 void creature_tracker::rebuild_cache()
 {
-    monsters_by_location.clear();
+    clear_locations();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
-        monsters_by_location[mon_ptr->pos_abs()] = mon_ptr;
+        set_location( mon_ptr->pos_abs(), mon_ptr );
     }
 }
 
@@ -235,13 +357,17 @@ void creature_tracker::swap_positions( monster &first, monster &second )
     shared_ptr_fast<monster> first_ptr;
     if( first_iter != monsters_by_location.end() ) {
         first_ptr = first_iter->second;
-        monsters_by_location.erase( first_iter );
     }
 
     shared_ptr_fast<monster> second_ptr;
     if( second_iter != monsters_by_location.end() ) {
         second_ptr = second_iter->second;
-        monsters_by_location.erase( second_iter );
+    }
+    if( first_ptr ) {
+        erase_location( first.pos_abs() );
+    }
+    if( second_ptr ) {
+        erase_location( second.pos_abs() );
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
@@ -251,10 +377,10 @@ void creature_tracker::swap_positions( monster &first, monster &second )
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
-        monsters_by_location[first.pos_abs()] = first_ptr;
+        set_location( first.pos_abs(), first_ptr );
     }
     if( second_ptr ) {
-        monsters_by_location[second.pos_abs()] = second_ptr;
+        set_location( second.pos_abs(), second_ptr );
     }
 }
 
@@ -70,6 +70,43 @@ class creature_tracker
         void for_each_reachable( const Creature &origin, FactionPredicateFn &&faction_fn,
                                  CreatureVisitFn &&creature_fn );
 
+        /**
+         * Visits the monsters within @p radius of @p center, the distance being the largest of
+         * the x, y and z distances.  Only the grid cells around center are searched, so this
+         * costs about as much as there are monsters close by.
+         *  - VisitFn: void(monster&)
+         * Dead monsters are ignored and not visited.  The visitor may move or kill monsters.
+         */
+        template <typename VisitFn>
+        void for_each_monster_in_radius( const tripoint_abs_ms &center, int radius,
+                                         VisitFn &&visit_fn ) const;
+        /**
+         * Same as above, but only visiting monsters of the factions matching the predicate.
+         *  - FactionPredicateFn: bool(const mfaction_id&)
+         *  - VisitFn: void(monster&)
+         */
+        template <typename FactionPredicateFn, typename VisitFn>
+        void for_each_monster_in_radius( const tripoint_abs_ms &center, int radius,
+                                         FactionPredicateFn &&faction_fn,
+                                         VisitFn &&visit_fn ) const;
+        /**
+         * Visits the monsters, NPCs and the avatar within @p radius of @p center, distance
+         * measured as above.
+         *  - VisitFn: void(Creature&)
+         * Dead creatures are ignored and not visited.
+         */
+        template <typename VisitFn>
+        void for_each_in_radius( const tripoint_abs_ms &center, int radius,
+                                 VisitFn &&visit_fn ) const;
+        /**
+         * Returns the creature within @p radius of @p center closest to it that matches the
+         * predicate, or nullptr.  Ties go to monsters first.
+         *  - PredicateFn: bool(Creature&)
+         */
+        template <typename PredicateFn>
+        Creature *nearest_matching( const tripoint_abs_ms &center, int radius,
+                                    PredicateFn &&predicate_fn ) const;
+
         /**
          * Returns a temporary id of the given monster (which must exist in the tracker).
          * The id is valid until monsters are added or removed from the tracker.
@@ -136,6 +173,20 @@ class creature_tracker
     private:
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
+        /** Puts @p critter into @ref monsters_by_location and the grid at @p pos. */
+        void set_location( const tripoint_abs_ms &pos, const shared_ptr_fast<monster> &critter );
+        /** Removes whatever monster is at @p pos from @ref monsters_by_location and the grid. */
+        void erase_location( const tripoint_abs_ms &pos );
+        void clear_locations();
+        /** Appends the live monsters within radius of center to @p out. */
+        void monsters_in_radius( const tripoint_abs_ms &center, int radius,
+                                 std::vector<monster *> &out ) const;
+        /** Appends the live creatures of any kind within radius of center to @p out. */
+        void creatures_in_radius( const tripoint_abs_ms &center, int radius,
+                                  std::vector<Creature *> &out ) const;
+        static tripoint grid_cell( const tripoint_abs_ms &pos );
+        static mfaction_id faction_of( const monster &critter );
+        static bool is_dead( const monster &critter );
 
         void flood_fill_zone( const Creature &origin );
 
@@ -148,6 +199,14 @@ class creature_tracker
         std::vector<shared_ptr_fast<monster>> monsters_list;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>> monsters_by_location;
+        /**
+         * The same monsters as @ref monsters_by_location, bucketed by grid cells of
+         * grid_size x grid_size tiles on each z-level, for radius queries.
+         */
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<tripoint, std::vector<std::pair<tripoint_abs_ms, monster *>>>
+                monster_grid;
+        static constexpr int grid_size = 16;
 
         /**
          * Creatures that get removed via @ref remove are stored here until the end of the turn.
@@ -228,4 +287,59 @@ void creature_tracker::for_each_reachable( const Creature &origin, FactionPredic
     } );
 }
 
+template <typename VisitFn>
+void creature_tracker::for_each_monster_in_radius( const tripoint_abs_ms &center, int radius,
+        VisitFn &&visit_fn ) const
+{
+    for_each_monster_in_radius( center, radius, []( const mfaction_id & ) {
+        return true;
+    }, std::forward<VisitFn>( visit_fn ) );
+}
+
+template <typename FactionPredicateFn, typename VisitFn>
+void creature_tracker::for_each_monster_in_radius( const tripoint_abs_ms &center, int radius,
+        FactionPredicateFn &&faction_fn, VisitFn &&visit_fn ) const
+{
+    // Collected first, the visitor may well move monsters between cells.
+    std::vector<monster *> found;
+    monsters_in_radius( center, radius, found );
+    for( monster *critter : found ) {
+        // Checked again, an earlier visit may have killed it.
+        if( !is_dead( *critter ) && faction_fn( faction_of( *critter ) ) ) {
+            visit_fn( *critter );
+        }
+    }
+}
+
+template <typename VisitFn>
+void creature_tracker::for_each_in_radius( const tripoint_abs_ms &center, int radius,
+        VisitFn &&visit_fn ) const
+{
+    std::vector<Creature *> found;
+    creatures_in_radius( center, radius, found );
+    for( Creature *critter : found ) {
+        if( !critter->is_dead_state() ) {
+            visit_fn( *critter );
+        }
+    }
+}
+
+template <typename PredicateFn>
+Creature *creature_tracker::nearest_matching( const tripoint_abs_ms &center, int radius,
+        PredicateFn &&predicate_fn ) const
+{
+    std::vector<Creature *> found;
+    creatures_in_radius( center, radius, found );
+    Creature *nearest = nullptr;
+    int nearest_dist = radius + 1;
+    for( Creature *critter : found ) {
+        const int dist = square_dist( center, critter->pos_abs() );
+        if( dist < nearest_dist && predicate_fn( *critter ) ) {
+            nearest = critter;
+            nearest_dist = dist;
+        }
+    }
+    return nearest;
+}
+
 #endif // CATA_SRC_CREATURE_TRACKER_H
@@ -2772,7 +2772,8 @@ static void character_edit_menu()
                 testfile << "|;key;value;" << std::endl;
 
                 for( const auto &value : you.get_values() ) {
-                    testfile << "|;" << value.first << ";" << value.second.to_string() << ";" << std::endl;
+                    testfile << "|;" << value.first.str() << ";" << value.second.to_string() << ";"
+                             << std::endl;
                 }
 
             }, "var_list" );
@@ -4065,7 +4066,8 @@ static void write_global_vars()
         testfile << "|;key;value;" << std::endl;
         global_variables::impl_t &globals = get_globals().get_global_values();
         for( const auto &value : globals ) {
-            testfile << "|;" << value.first << ";" << value.second.to_string() << ";" << std::endl;
+            testfile << "|;" << value.first.str() << ";" << value.second.to_string() << ";"
+                     << std::endl;
         }
 
     }, "var_list" );
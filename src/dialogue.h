@@ -245,17 +245,17 @@ struct const_dialogue {
         bool by_radio = false;
 
         // Methods for setting/getting misc key/value pairs.
-        void set_value( const std::string &key, diag_value value );
+        void set_value( const var_key &key, diag_value value );
         template <typename... Args>
-        void set_value( const std::string &key, Args... args ) {
+        void set_value( const var_key &key, Args... args ) {
             set_value( key, diag_value{ std::forward<Args>( args )... } );
         }
-        void remove_value( const std::string &key );
+        void remove_value( const var_key &key );
 
         void set_conditional( const std::string &key,
                               const std::function<bool( const_dialogue const & )> &value );
-        diag_value const &get_value( const std::string &key ) const;
-        diag_value const *maybe_get_value( const std::string &key ) const;
+        diag_value const &get_value( const var_key &key ) const;
+        diag_value const *maybe_get_value( const var_key &key ) const;
 
         bool evaluate_conditional( const std::string &key, const_dialogue const &d ) const;
 
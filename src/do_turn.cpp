@@ -26,6 +26,7 @@
 #include "cata_variant.h"
 #include "clzones.h"
 #include "coordinates.h"
+#include "creature_tracker.h"
 #include "debug.h"
 #include "enums.h"
 #include "event.h"
@@ -61,6 +62,7 @@
 #include "popup.h"
 #include "rng.h"
 #include "scent_map.h"
+#include "scratch_vector.h"
 #include "sdlsound.h"
 #include "simple_pathfinding.h"
 #include "sounds.h"
@@ -95,6 +97,10 @@ static const json_character_flag json_flag_NO_SCENT( "NO_SCENT" );
 
 static const trait_id trait_HAS_NEMESIS( "HAS_NEMESIS" );
 
+static const option_ref<bool> option_AUTOSAVE( "AUTOSAVE" );
+static const option_ref<int> option_AUTOSAVE_TURNS( "AUTOSAVE_TURNS" );
+static const option_ref<bool> option_FORCE_REDRAW( "FORCE_REDRAW" );
+
 #if defined(__ANDROID__)
 extern std::map<std::string, std::list<input_event>> quick_shortcuts_map;
 extern bool add_best_key_for_action_to_quick_shortcuts( action_id action,
@@ -458,6 +464,41 @@ void overmap_npc_move()
 
 } // namespace
 
+// The part of can_fast_forward() that is cheap enough to check every turn.
+static bool resting_undisturbed( const avatar &u )
+{
+    // Being knocked out or anesthetized puts the sleep effect on too. Awake activities react to
+    // effects and stats every turn, so they don't qualify.
+    if( !u.has_effect( effect_sleep ) ) {
+        return false;
+    }
+    if( u.is_dead_state() || u.controlling_vehicle || g->uquit == QUIT_WATCH ) {
+        return false;
+    }
+    // Whatever the last mon_info_update() spotted, e.g. while sleeping with the SEESLEEP flag.
+    return !u.get_mon_visible().has_dangerous_creature_in_proximity;
+}
+
+bool can_fast_forward( const avatar &u )
+{
+    if( !resting_undisturbed( u ) ) {
+        return false;
+    }
+    const Creature *threat = get_creature_tracker().nearest_matching( u.pos_abs(),
+    MAX_VIEW_DISTANCE, [&u]( const Creature & critter ) {
+        return &critter != &u && critter.attitude_to( u ) == Creature::Attitude::HOSTILE;
+    } );
+    return threat == nullptr;
+}
+
+bool fast_forward_this_turn( const avatar &u )
+{
+    if( calendar::once_every( avatar::body_update_step ) ) {
+        return can_fast_forward( u );
+    }
+    return u.is_body_updated_in_steps() && resting_undisturbed( u );
+}
+
 // MAIN GAME LOOP
 // Returns true if game is over (death, saved, quit, etc)
 bool do_turn()
@@ -490,6 +531,12 @@ bool do_turn()
 
     // starting a new turn, clear out temperature cache
     weather.temperature_cache.clear();
+    // The scratch vectors should be big enough for everything after the first few turns.
+    const int scratch_allocations = scratch_vectors::take_allocation_count();
+    if( scratch_allocations > 0 ) {
+        add_msg_debug( debugmode::DF_GAME, "Scratch vectors allocated %d times last turn",
+                       scratch_allocations );
+    }
 
     if( g->npcs_dirty ) {
         g->load_npcs();
@@ -530,13 +577,21 @@ bool do_turn()
         }
     }
 
+    // Generate the surroundings of the bubble ahead of time, so moving doesn't stall on mapgen
+    if( !test_mode ) {
+        mapgen_jobs::run( 1 );
+    }
+
     g->debug_hour_timer.print_time();
 
-    u.update_body();
+    // Nothing needs to-the-turn updates while the avatar sleeps undisturbed.  Once something
+    // hostile shows up or the avatar wakes up this goes back to updating every turn.
+    const bool fast_forward = fast_forward_this_turn( u );
+    u.update_body_in_steps( fast_forward );
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( option_AUTOSAVE.get() &&
+        calendar::once_every( 1_turns * option_AUTOSAVE_TURNS.get() ) &&
         !u.is_dead_state() ) {
         g->autosave();
     }
@@ -686,9 +741,11 @@ bool do_turn()
             }
         }
     }
-    g->mon_info_update();
+    if( !fast_forward || calendar::once_every( avatar::body_update_step ) ) {
+        g->mon_info_update();
+    }
     u.process_turn();
-    if( u.get_moves() < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( u.get_moves() < 0 && option_FORCE_REDRAW.get() ) {
         ui_manager::redraw();
         refresh_display();
     }
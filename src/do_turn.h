@@ -2,8 +2,20 @@
 #ifndef CATA_SRC_DO_TURN_H
 #define CATA_SRC_DO_TURN_H
 
+class avatar;
+
 /** MAIN GAME LOOP. Returns true if game is over (death, saved, quit, etc.). */
 bool do_turn();
 void handle_key_blocking_activity();
+/**
+ * Whether the avatar is asleep or unconscious and nothing hostile is in view range, in which
+ * case @ref do_turn updates the avatar's body and the monster list in coarse steps.
+ */
+bool can_fast_forward( const avatar &u );
+/**
+ * Whether @ref do_turn fast forwards this turn. The surroundings are only searched for hostiles
+ * by @ref can_fast_forward once every step; in between, waking up still ends it right away.
+ */
+bool fast_forward_this_turn( const avatar &u );
 
 #endif // CATA_SRC_DO_TURN_H
@@ -1027,6 +1027,40 @@ std::string effect::disp_mod_source_info() const
     return get_origin( eff_type->src );
 }
 
+std::map<bodypart_id, effect> &effects_map::operator[]( const efftype_id &id )
+{
+    types |= bit_of( id );
+    return base::operator[]( id );
+}
+
+void effects_map::merge( effects_map &other )
+{
+    base::merge( static_cast<base &>( other ) );
+    recount_types();
+    other.recount_types();
+}
+
+effects_map::size_type effects_map::erase( const efftype_id &id )
+{
+    const size_type erased = base::erase( id );
+    recount_types();
+    return erased;
+}
+
+void effects_map::clear()
+{
+    base::clear();
+    types = 0;
+}
+
+void effects_map::recount_types()
+{
+    types = 0;
+    for( const value_type &elem : *this ) {
+        types |= bit_of( elem.first );
+    }
+}
+
 static bool effect_is_blocked( const efftype_id &e, const effects_map &eff_map )
 {
     for( const auto &eff_grp : eff_map ) {
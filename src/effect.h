@@ -5,6 +5,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <optional>
 #include <set>
@@ -255,9 +256,33 @@ class effect;
 
 // Inheritance here allows forward declaration of the map in class Creature.
 // Storing body_part as an int_id to make things easier for hash and JSON
+// The members below shadow the ones of std::map that add or remove effect types, so that
+// might_have can rule out most missing effects without searching the map.
 class effects_map : public
     std::map<efftype_id, std::map<bodypart_id, effect>>
 {
+        using base = std::map<efftype_id, std::map<bodypart_id, effect>>;
+    public:
+        std::map<bodypart_id, effect> &operator[]( const efftype_id &id );
+        template<typename... Args>
+        std::pair<iterator, bool> emplace( Args &&... args );
+        void merge( effects_map &other );
+        size_type erase( const efftype_id &id );
+        void clear();
+
+        /** False if there is no effect of that type, true if there might be one. */
+        bool might_have( const efftype_id &id ) const {
+            return types & bit_of( id );
+        }
+
+    private:
+        // One bit per effect type, types that share a bit still need the map lookup.
+        static std::uint64_t bit_of( const efftype_id &id ) {
+            return std::uint64_t{ 1 } << ( std::hash<efftype_id> {}( id ) % 64 );
+        }
+        void recount_types();
+
+        std::uint64_t types = 0;
 };
 
 class effect
@@ -467,6 +492,14 @@ class effect
 
 };
 
+template<typename... Args>
+std::pair<effects_map::iterator, bool> effects_map::emplace( Args &&... args )
+{
+    std::pair<iterator, bool> result = base::emplace( std::forward<Args>( args )... );
+    types |= bit_of( result.first->first );
+    return result;
+}
+
 class effect_migration
 {
     public:
@@ -1,17 +1,14 @@
 #include "effect_on_condition.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
-#include <iterator>
-#include <list>
 #include <memory>
 #include <unordered_map>
 #include <ostream>
-#include <queue>
 
 #include "avatar.h"
 #include "calendar.h"
-#include "cata_scope_helpers.h"
 #include "cata_utility.h"
 #include "cata_variant.h"
 #include "character.h"
@@ -58,6 +55,26 @@ namespace
 {
 generic_factory<effect_on_condition>
 effect_on_condition_factory( "effect_on_condition" );
+
+std::unordered_map<effect_on_condition_id, eoc_eval_stats> eval_stats;
+
+void write_eval_stats( std::ostream &testfile )
+{
+    std::vector<std::pair<effect_on_condition_id, eoc_eval_stats>> sorted( eval_stats.begin(),
+            eval_stats.end() );
+    std::sort( sorted.begin(), sorted.end(), []( const auto & lhs, const auto & rhs ) {
+        return lhs.second.total > rhs.second.total;
+    } );
+    testfile << "evaluation time:" << std::endl;
+    testfile << "id;evaluations;total us;longest us" << std::endl;
+    for( const std::pair<effect_on_condition_id, eoc_eval_stats> &entry : sorted ) {
+        using std::chrono::microseconds;
+        testfile << entry.first.c_str() << ";" << entry.second.evaluations << ";"
+                 << std::chrono::duration_cast<microseconds>( entry.second.total ).count() << ";"
+                 << std::chrono::duration_cast<microseconds>( entry.second.longest ).count()
+                 << std::endl;
+    }
+}
 } // namespace
 
 template<>
@@ -77,6 +94,19 @@ void effect_on_conditions::check_consistency()
 {
 }
 
+void eoc_eval_stats::add( std::chrono::nanoseconds time )
+{
+    evaluations++;
+    total += time;
+    longest = std::max( longest, time );
+}
+
+const std::unordered_map<effect_on_condition_id, eoc_eval_stats> &
+effect_on_conditions::get_eval_stats()
+{
+    return eval_stats;
+}
+
 void effect_on_condition::load( const JsonObject &jo, std::string_view src )
 {
     mandatory( jo, was_loaded, "id", id );
@@ -169,15 +199,14 @@ static void process_new_eocs( queued_eocs &eoc_queue,
                               std::map<effect_on_condition_id, bool> &new_eocs, bool global_queue )
 {
     queued_eocs temp_queued_eocs;
-    while( !eoc_queue.empty() ) {
+    for( const queued_eoc &queued : eoc_queue.list ) {
         // Check if EoC is moved from global to local, or vice versa
-        if( global_queue == eoc_queue.top().eoc->global ) {
-            if( eoc_queue.top().eoc.is_valid() ) {
-                temp_queued_eocs.push( eoc_queue.top() );
+        if( global_queue == queued.eoc->global ) {
+            if( queued.eoc.is_valid() ) {
+                temp_queued_eocs.push( queued );
             }
-            new_eocs[eoc_queue.top().eoc] = false;
+            new_eocs[queued.eoc] = false;
         }
-        eoc_queue.pop();
     }
     eoc_queue = std::move( temp_queued_eocs );
     for( auto eoc = eoc_vector.begin();
@@ -234,62 +263,47 @@ void effect_on_conditions::queue_effect_on_condition( time_duration duration,
 static void process_eocs( queued_eocs &eoc_queue, std::vector<effect_on_condition_id> &eoc_vector,
                           dialogue &d )
 {
-    static int reentrancy_depth = 0;
-    ++reentrancy_depth;
-
-    // Have to use a typedef because astyle does not settle on the spacing for the & when inline.
-    using queue_t = std::vector<queued_eocs::storage_iter> &;
-    queue_t eocs_to_queue = []() -> queue_t {
-        static std::list<std::vector<queued_eocs::storage_iter>> cached_queues;
-        if( reentrancy_depth < 0 )
-        {
-            debugmsg( "How can we unrecurse more than we recurse?" );
-        }
-        while( cached_queues.size() < static_cast<size_t>( reentrancy_depth ) )
-        {
-            cached_queues.emplace_back();
-        }
-        auto it = cached_queues.begin();
-        std::advance( it, reentrancy_depth - 1 );
-        return *it;
-    }();
-
-    on_out_of_scope cleanup{ [&] {
-            --reentrancy_depth;
-            eocs_to_queue.clear();
-        } };
-
-    while( !eoc_queue.empty() &&
-           eoc_queue.top().time <= calendar::turn ) {
-        queued_eocs::storage_iter it = eoc_queue.queue.top();
-        queued_eoc &top = *it;
-        eoc_queue.queue.pop();
-
-        dialogue nested_d{ d };
-        for( const auto &val : top.context ) {
-            nested_d.set_value( val.first, val.second );
-        }
-        bool activated = top.eoc->activate( nested_d );
-        if( top.eoc->type == eoc_type::RECURRING ) {
-            if( activated ) { // It worked so add it back
-                it->time = calendar::turn + next_recurrence( top.eoc, d );
-                eocs_to_queue.emplace_back( it );
-            } else {
-                if( !top.eoc->check_deactivate(
-                        nested_d ) ) { // It failed but shouldn't be deactivated so add it back
-                    it->time = calendar::turn + next_recurrence( top.eoc, d );
-                    eocs_to_queue.emplace_back( it );
-                } else { // It failed and should be deactivated for now
+    // Everything due this turn is taken out of the queue as one batch.  EOCs queued by the batch
+    // that are already due run in the next batch of the same call.  Recurring EOCs are put back
+    // into the queue right away, unless their recurrence is zero; those wait until the end so
+    // that they run at most once per call.
+    std::vector<queued_eocs::storage_iter> batch;
+    std::vector<queued_eocs::storage_iter> due_again;
+    eoc_queue.take_due( calendar::turn, batch );
+    while( !batch.empty() ) {
+        for( queued_eocs::storage_iter it : batch ) {
+            queued_eoc &top = *it;
+            dialogue nested_d{ d };
+            for( const auto &val : top.context ) {
+                nested_d.set_value( val.first, val.second );
+            }
+            const auto start = std::chrono::steady_clock::now();
+            bool activated = top.eoc->activate( nested_d );
+            bool requeue = false;
+            if( top.eoc->type == eoc_type::RECURRING ) {
+                // Add it back if it worked or if it failed but shouldn't be deactivated
+                requeue = activated || !top.eoc->check_deactivate( nested_d );
+                if( !requeue ) { // It failed and should be deactivated for now
                     eoc_vector.push_back( top.eoc );
-                    eoc_queue.list.erase( it );
                 }
             }
-        } else {
-            eoc_queue.list.erase( it );
+            eval_stats[top.eoc].add( std::chrono::steady_clock::now() - start );
+            if( !requeue ) {
+                eoc_queue.erase( it );
+                continue;
+            }
+            it->time = calendar::turn + next_recurrence( top.eoc, d );
+            if( it->time > calendar::turn ) {
+                eoc_queue.reschedule( it );
+            } else {
+                due_again.emplace_back( it );
+            }
         }
+        batch.clear();
+        eoc_queue.take_due( calendar::turn, batch );
     }
-    for( queued_eocs::storage_iter &q_eoc : eocs_to_queue ) {
-        eoc_queue.queue.emplace( q_eoc );
+    for( queued_eocs::storage_iter it : due_again ) {
+        eoc_queue.reschedule( it );
     }
 }
 
@@ -408,14 +422,11 @@ void effect_on_condition::apply_true_effects( dialogue &d )  const
 
 void effect_on_conditions::clear( Character &you )
 {
-    while( !you.queued_effect_on_conditions.empty() ) {
-        you.queued_effect_on_conditions.pop();
-    }
+    you.queued_effect_on_conditions.clear();
     you.inactive_effect_on_condition_vector.clear();
-    while( !g->queued_global_effect_on_conditions.empty() ) {
-        g->queued_global_effect_on_conditions.pop();
-    }
+    g->queued_global_effect_on_conditions.clear();
     g->inactive_global_effect_on_condition_vector.clear();
+    eval_stats.clear();
 }
 
 void effect_on_conditions::write_eocs_to_file( Character &you )
@@ -425,19 +436,9 @@ void effect_on_conditions::write_eocs_to_file( Character &you )
         testfile << "id;timepoint;recurring" << std::endl;
 
         testfile << "queued eocs:" << std::endl;
-        std::vector<queued_eoc> temp_queue;
-        while( !you.queued_effect_on_conditions.empty() ) {
-            temp_queue.push_back( you.queued_effect_on_conditions.top() );
-            you.queued_effect_on_conditions.pop();
-        }
-
-        for( const queued_eoc &queue_entry : temp_queue ) {
-            time_duration temp = queue_entry.time - calendar::turn;
-            testfile << queue_entry.eoc.c_str() << ";" << to_string( temp ) << std::endl;
-        }
-
-        for( const queued_eoc &queued : temp_queue ) {
-            you.queued_effect_on_conditions.push( queued );
+        for( const queued_eoc *queue_entry : you.queued_effect_on_conditions.sorted() ) {
+            time_duration temp = queue_entry->time - calendar::turn;
+            testfile << queue_entry->eoc.c_str() << ";" << to_string( temp ) << std::endl;
         }
 
         testfile << "inactive eocs:" << std::endl;
@@ -445,6 +446,7 @@ void effect_on_conditions::write_eocs_to_file( Character &you )
             testfile << eoc.c_str() << std::endl;
         }
 
+        write_eval_stats( testfile );
     }, "eocs test file" );
 }
 
@@ -455,19 +457,9 @@ void effect_on_conditions::write_global_eocs_to_file( )
         testfile << "id;timepoint;recurring" << std::endl;
 
         testfile << "queued eocs:" << std::endl;
-        std::vector<queued_eoc> temp_queue;
-        while( !g->queued_global_effect_on_conditions.empty() ) {
-            temp_queue.push_back( g->queued_global_effect_on_conditions.top() );
-            g->queued_global_effect_on_conditions.pop();
-        }
-
-        for( const queued_eoc &queue_entry : temp_queue ) {
-            time_duration temp = queue_entry.time - calendar::turn;
-            testfile << queue_entry.eoc.c_str() << ";" << to_string( temp ) << std::endl;
-        }
-
-        for( const queued_eoc &queued : temp_queue ) {
-            g->queued_global_effect_on_conditions.push( queued );
+        for( const queued_eoc *queue_entry : g->queued_global_effect_on_conditions.sorted() ) {
+            time_duration temp = queue_entry->time - calendar::turn;
+            testfile << queue_entry->eoc.c_str() << ";" << to_string( temp ) << std::endl;
         }
 
         testfile << "inactive eocs:" << std::endl;
@@ -475,6 +467,7 @@ void effect_on_conditions::write_global_eocs_to_file( )
             testfile << eoc.c_str() << std::endl;
         }
 
+        write_eval_stats( testfile );
     }, "eocs test file" );
 }
 
@@ -2,10 +2,12 @@
 #ifndef CATA_SRC_EFFECT_ON_CONDITION_H
 #define CATA_SRC_EFFECT_ON_CONDITION_H
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -77,6 +79,15 @@ struct effect_on_condition {
         void check() const;
         effect_on_condition() = default;
 };
+/** Time spent running one queued effect_on_condition */
+struct eoc_eval_stats {
+    int evaluations = 0;
+    std::chrono::nanoseconds total{ 0 };
+    std::chrono::nanoseconds longest{ 0 };
+
+    void add( std::chrono::nanoseconds time );
+};
+
 namespace effect_on_conditions
 {
 /** Get all currently loaded effect_on_conditions */
@@ -105,7 +116,9 @@ void process_reactivate( Character &you );
 void process_reactivate();
 /** clear all queued and inactive eocs */
 void clear( Character &you );
-/** write out all queued eocs and inactive eocs to a file for testing */
+/** Evaluation time of each queued eoc that ran since the game was set up */
+const std::unordered_map<effect_on_condition_id, eoc_eval_stats> &get_eval_stats();
+/** write out all queued eocs, inactive eocs and their evaluation times to a file for testing */
 void write_eocs_to_file( Character &you );
 void write_global_eocs_to_file();
 /** Run all prevent death eocs */
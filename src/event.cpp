@@ -1,6 +1,8 @@
 #include "event.h"
 
+#include <array>
 #include <string>
+#include <utility>
 
 #include "debug.h"
 
@@ -223,51 +225,114 @@ DEFINE_EVENT_FIELDS( character_butchered_corpse )
 
 } // namespace event_detail
 
-template<event_type Type>
-static void get_fields_if_match( event_type type, event::fields_type &out )
+template<int... I>
+static constexpr std::array<event_detail::event_field_list, sizeof...( I )>
+make_field_lists( std::integer_sequence<int, I...> )
 {
-    if( Type == type ) {
-        out = { event_detail::event_spec<Type>::fields.begin(),
-                event_detail::event_spec<Type>::fields.end()
-              };
+    return { {
+            event_detail::event_field_list{
+                event_detail::event_spec<static_cast<event_type>( I )>::fields.data(),
+                event_detail::event_spec<static_cast<event_type>( I )>::fields.size()
+            }...
+        }
+    };
+}
+
+static constexpr std::array<event_detail::event_field_list,
+       static_cast<int>( event_type::num_event_types )> field_lists = make_field_lists(
+           std::make_integer_sequence<int, static_cast<int>( event_type::num_event_types )> {} );
+
+static constexpr bool all_fields_fit()
+{
+    for( const event_detail::event_field_list &fields : field_lists ) {
+        if( fields.size() > event_detail::max_event_fields ) {
+            return false;
+        }
     }
+    return true;
 }
+static_assert( all_fields_fit(), "event_detail::max_event_fields is too small" );
 
-template<int... I>
-static event::fields_type
-get_fields_helper( event_type type, std::integer_sequence<int, I...> )
+event_detail::event_field_list event_detail::fields_of( event_type type )
 {
-    event::fields_type result;
-    std::array<bool, sizeof...( I )> discard = {
-        ( get_fields_if_match<static_cast<event_type>( I )>( type, result ), true )...
-    };
-    ( void ) discard;
-    return result;
+    if( type == event_type::num_event_types ) {
+        return {};
+    }
+    return field_lists[static_cast<int>( type )];
 }
 
 event::fields_type event::get_fields( event_type type )
 {
-    return get_fields_helper(
-               type, std::make_integer_sequence<int, static_cast<int>( event_type::num_event_types )> {} );
+    const event_detail::event_field_list fields = event_detail::fields_of( type );
+    return { fields.begin(), fields.end() };
+}
+
+event::event( event_type type, time_point time, data_type &&data )
+    : type_( type )
+    , time_( time )
+{
+    const event_detail::event_field_list fields = event_detail::fields_of( type );
+    bool matches_spec = data.size() == fields.size();
+    for( std::size_t i = 0; matches_spec && i < fields.size(); ++i ) {
+        auto it = data.find( fields[i].first );
+        if( it == data.end() ) {
+            matches_spec = false;
+        } else {
+            payload_[i] = it->second;
+        }
+    }
+    if( !matches_spec ) {
+        payload_ = {};
+        dynamic_data_ = std::move( data );
+        dynamic_ = true;
+    }
+}
+
+const cata_variant *event::find( const std::string &key ) const
+{
+    if( dynamic_ ) {
+        auto it = dynamic_data_.find( key );
+        return it == dynamic_data_.end() ? nullptr : &it->second;
+    }
+    const event_detail::event_field_list fields = event_detail::fields_of( type_ );
+    for( std::size_t i = 0; i < fields.size(); ++i ) {
+        if( key == fields[i].first ) {
+            return &payload_[i];
+        }
+    }
+    return nullptr;
 }
 
 cata_variant event::get_variant( const std::string &key ) const
 {
-    auto it = data_.find( key );
-    if( it == data_.end() ) {
+    const cata_variant *value = find( key );
+    if( !value ) {
         cata_fatal( "No such key %s in event of type %s", key,
                     io::enum_to_string( type_ ) );
     }
-    return it->second;
+    return *value;
 }
 
 cata_variant event::get_variant_or_void( const std::string &key ) const
 {
-    auto it = data_.find( key );
-    if( it == data_.end() ) {
+    const cata_variant *value = find( key );
+    if( !value ) {
         return cata_variant();
     }
-    return it->second;
+    return *value;
+}
+
+event::data_type event::data() const
+{
+    if( dynamic_ ) {
+        return dynamic_data_;
+    }
+    data_type result;
+    const event_detail::event_field_list fields = event_detail::fields_of( type_ );
+    for( std::size_t i = 0; i < fields.size(); ++i ) {
+        result.emplace( fields[i].first, payload_[i] );
+    }
+    return result;
 }
 
 } // namespace cata
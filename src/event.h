@@ -6,12 +6,14 @@
 #include <cstddef>
 #include <map>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "calendar.h"
+#include "cata_assert.h"
 #include "cata_variant.h"
 
 template <typename E> struct enum_traits;
@@ -165,15 +167,53 @@ namespace cata
 namespace event_detail
 {
 
-// An event has various data stored in a map keyed by strings.  The specific
-// keys and corresponding data types are specified in a specialization of
-// event_spec.
+// An event has various data fields.  Their names and data types are specified
+// in a specialization of event_spec.  The values are stored in a fixed-size
+// array in the order of the spec, so fields can be addressed by index.
 
 using event_field = std::pair<const char *, cata_variant_type>;
 
+// The most fields any event_spec has
+constexpr std::size_t max_event_fields = 11;
+
 template<event_type Type>
 struct event_spec;
 
+// The fields of one event_spec, usable at runtime
+struct event_field_list {
+    const event_field *first = nullptr;
+    std::size_t count = 0;
+
+    constexpr const event_field *begin() const {
+        return first;
+    }
+    constexpr const event_field *end() const {
+        return first + count;
+    }
+    constexpr std::size_t size() const {
+        return count;
+    }
+    constexpr const event_field &operator[]( std::size_t i ) const {
+        return first[i];
+    }
+};
+
+event_field_list fields_of( event_type );
+
+// Index of the field called name in the spec for Type, or the number of
+// fields if there is no such field.  Meant to be evaluated at compile time.
+template<event_type Type>
+constexpr std::size_t field_index( std::string_view name )
+{
+    constexpr auto &fields = event_spec<Type>::fields;
+    for( std::size_t i = 0; i < fields.size(); ++i ) {
+        if( name == fields[i].first ) {
+            return i;
+        }
+    }
+    return fields.size();
+}
+
 struct event_spec_empty {
     static constexpr std::array<event_field, 0> fields = {};
 };
@@ -963,11 +1003,18 @@ class event
 {
     public:
         using data_type = std::map<std::string, cata_variant>;
-
-        event( event_type type, time_point time, data_type &&data )
+        // Field values in the order of the event_spec fields.  Entries past the
+        // last field are void.
+        using payload_type = std::array<cata_variant, event_detail::max_event_fields>;
+
+        // Accepts any set of fields.  When they are exactly the fields of the
+        // spec for the type they are stored as a payload, otherwise (e.g. for
+        // events produced by event_transformations) the map is kept as is.
+        event( event_type type, time_point time, data_type &&data );
+        event( event_type type, time_point time, payload_type &&payload )
             : type_( type )
             , time_( time )
-            , data_( std::move( data ) )
+            , payload_( std::move( payload ) )
         {}
         event() : type_( event_type::num_event_types ) {}
 
@@ -983,6 +1030,8 @@ class event
                            "spec for this event type must be defined and empty" );
             static_assert( sizeof...( Args ) == Spec::fields.size(),
                            "wrong number of arguments for event type" );
+            static_assert( Spec::fields.size() <= event_detail::max_event_fields,
+                           "event_detail::max_event_fields is too small for this event type" );
 
             return event_detail::make_event_helper <
                    Type, std::make_index_sequence<sizeof...( Args )>
@@ -1016,13 +1065,50 @@ class event
             return get_variant( key ).get<T>();
         }
 
-        const data_type &data() const {
-            return data_;
+        // Typed access to a field by index, without any lookup by name, e.g.
+        // e.get<event_type::character_kills_monster,
+        //       event::field_index<event_type::character_kills_monster>( "exp" )>()
+        template<event_type Type, std::size_t Index>
+        auto get() const {
+            using Spec = event_detail::event_spec<Type>;
+            static_assert( Index < Spec::fields.size(), "no such field for this event type" );
+            cata_assert( type_ == Type && !dynamic_ );
+            return payload_[Index].get<Spec::fields[Index].second>();
+        }
+
+        template<event_type Type>
+        static constexpr std::size_t field_index( std::string_view name ) {
+            return event_detail::field_index<Type>( name );
+        }
+
+        // The field values in spec order, or nullptr for events that don't
+        // have the fields of their spec.
+        const payload_type *payload() const {
+            return dynamic_ ? nullptr : &payload_;
         }
+
+        // Builds a map of all the fields
+        data_type data() const;
     private:
+        const cata_variant *find( const std::string &key ) const;
+
         event_type type_;
         time_point time_;
-        data_type data_;
+        payload_type payload_;
+        // Only used when dynamic_ is set
+        data_type dynamic_data_;
+        bool dynamic_ = false;
+};
+
+// Hash for event payloads, cheaper than hashing the equivalent data_type
+struct event_payload_hash {
+    std::size_t operator()( const event::payload_type &payload ) const noexcept {
+        std::size_t seed = 0;
+        for( const cata_variant &v : payload ) {
+            hash_combine( seed, v );
+        }
+        return seed;
+    }
 };
 
 namespace event_detail
@@ -1034,13 +1120,9 @@ struct make_event_helper<Type, std::index_sequence<I...>> {
 
     template<typename... Args>
     event operator()( time_point time, Args &&... args ) {
-        return event(
-                   Type,
-                   time,
-        std::map<std::string, cata_variant> { {
-                Spec::fields[I].first,
-                cata_variant::make<Spec::fields[I].second>( args )
-            } ...
+        return event( Type, time, event::payload_type{ {
+                cata_variant::make<Spec::fields[I].second>( args )...
+            }
         } );
     }
 };
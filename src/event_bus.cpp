@@ -121,13 +121,9 @@ struct make_dyn_helper<Type, std::index_sequence<I...>> {
     using Spec = cata::event_detail::event_spec<Type>;
 
     cata::event operator()( time_point time, std::vector<std::string> &args ) {
-        return cata::event(
-                   Type,
-                   time,
-        std::map<std::string, cata_variant> { {
-                Spec::fields[I].first,
-                cata_variant::from_string( Spec::fields[I].second, std::move( args[I] ) )
-            } ...
+        return cata::event( Type, time, cata::event::payload_type{ {
+                cata_variant::from_string( Spec::fields[I].second, std::move( args[I] ) )...
+            }
         } );
     }
 };
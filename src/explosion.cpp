@@ -655,9 +655,10 @@ void flashbang( const tripoint_bub_ms &p, bool player_immune, const int radius )
         penalize_char( here, guy, p, radius );
     }
 
-    for( monster &critter : g->all_monsters() ) {
+    get_creature_tracker().for_each_monster_in_radius( here.get_abs( p ), radius,
+    [&]( monster & critter ) {
         if( critter.type->in_species( species_ROBOT ) || critter.has_flag( mon_flag_FLASHBANGPROOF ) ) {
-            continue;
+            return;
         }
         // TODO: can the following code be called for all types of creatures
         int dist = rl_dist( critter.pos_bub(), p );
@@ -672,7 +673,7 @@ void flashbang( const tripoint_bub_ms &p, bool player_immune, const int radius )
                 critter.add_effect( effect_deaf, time_duration::from_turns( radius * 7.5f - dist * 4 ) );
             }
         }
-    }
+    } );
     sounds::sound( p, 120, sounds::sound_t::combat, _( "a huge boom!" ), false, "misc", "flashbang" );
 }
 
@@ -684,15 +685,16 @@ void shockwave( const tripoint_bub_ms &p, int radius, int force, int stun, int d
     sounds::sound( p, force * force * dam_mult / 2, sounds::sound_t::combat, _( "Crack!" ), false,
                    "misc", "shockwave" );
 
-    for( monster &critter : g->all_monsters() ) {
+    get_creature_tracker().for_each_monster_in_radius( get_map().get_abs( p ), radius,
+    [&]( monster & critter ) {
         if( critter.posz() != p.z() ) {
-            continue;
+            return;
         }
         if( rl_dist( critter.pos_bub(), p ) <= radius ) {
             add_msg( _( "%s is caught in the shockwave!" ), critter.name() );
             g->knockback( p, critter.pos_bub(), force, stun, dam_mult );
         }
-    }
+    } );
     // TODO: combine the two loops and the case for avatar using all_creatures()
     for( npc &guy : g->all_npcs() ) {
         if( guy.posz() != p.z() ) {
@@ -395,6 +395,13 @@ bool flag_id::is_valid() const
     return json_flags_all.is_valid( *this );
 }
 
+/** @relates string_id */
+template<>
+int_id<json_flag> flag_id::id() const
+{
+    return json_flags_all.convert( *this, int_id<json_flag>( -1 ), false );
+}
+
 /** @relates string_id */
 template<>
 const json_flag &flag_id::obj() const
@@ -736,9 +736,9 @@ void game::legacy_migrate_npctalk_var_prefix( global_variables::impl_t &map_of_v
 
     const std::string prefix = "npctalk_var_";
     for( auto i = map_of_vars.begin(); i != map_of_vars.end(); ) {
-        if( i->first.rfind( prefix, 0 ) == 0 ) {
+        if( i->first.str().rfind( prefix, 0 ) == 0 ) {
             auto extracted =  map_of_vars.extract( i++ );
-            std::string new_key = extracted.key().substr( prefix.size() );
+            std::string new_key = extracted.key().str().substr( prefix.size() );
             extracted.key() = new_key;
             map_of_vars.insert( std::move( extracted ) );
         } else {
@@ -11191,6 +11191,8 @@ point_rel_sm game::update_map( int &x, int &y, bool z_level_changed )
     // Update what parts of the world map we can see
     update_overmap_seen();
 
+    mapgen_jobs::queue_ahead_of_bubble( here, shift );
+
     return shift;
 }
 
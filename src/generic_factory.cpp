@@ -6,6 +6,33 @@
 #include "output.h"
 #include "wcwidth.h"
 
+void interned_id_table::build( const std::vector<std::pair<int, int>> &entries )
+{
+    // keep the load factor at or below 1/2 so probe sequences stay short
+    int bits = 1;
+    while( ( size_t{ 1 } << bits ) < entries.size() * 2 ) {
+        ++bits;
+    }
+    slots.assign( size_t{ 1 } << bits, slot() );
+    mask = slots.size() - 1;
+    shift = 32 - bits;
+    for( const std::pair<int, int> &entry : entries ) {
+        size_t i = bucket( entry.first );
+        while( slots[i].key != INVALID_CID ) {
+            i = ( i + 1 ) & mask;
+        }
+        slots[i].key = entry.first;
+        slots[i].value = entry.second;
+    }
+}
+
+void interned_id_table::clear()
+{
+    slots.clear();
+    mask = 0;
+    shift = 0;
+}
+
 void warn_disabled_feature( const JsonObject &jo, const std::string_view feature,
                             const std::string_view member, const std::string_view reason )
 {
@@ -44,6 +44,49 @@ template <typename E> class enum_bitset;
 template<typename T> struct weighted_int_list;
 template <typename T, typename W> struct weighted_list;
 
+/**
+ * Open addressing table mapping interned string indices (see string_identity_static)
+ * to int ids. generic_factory builds one in finalize() so that the first lookup of a
+ * new string_id doesn't have to go through the node based hash map.
+ */
+class interned_id_table
+{
+    public:
+        // Builds the table from ( interned index, int id ) pairs
+        void build( const std::vector<std::pair<int, int>> &entries );
+        void clear();
+
+        // Returns the int id for the interned index, or INVALID_CID if there is none
+        int find( int interned ) const {
+            if( slots.empty() ) {
+                return INVALID_CID;
+            }
+            for( size_t i = bucket( interned ); ; i = ( i + 1 ) & mask ) {
+                const slot &s = slots[i];
+                if( s.key == interned ) {
+                    return s.value;
+                }
+                if( s.key == INVALID_CID ) {
+                    return INVALID_CID;
+                }
+            }
+        }
+
+    private:
+        struct slot {
+            int key = INVALID_CID;
+            int value = INVALID_CID;
+        };
+        std::vector<slot> slots;
+        size_t mask = 0;
+        int shift = 0;
+
+        // Fibonacci hashing, interned indices are sequential so they need some mixing
+        size_t bucket( int key ) const {
+            return ( static_cast<uint32_t>( key ) * UINT32_C( 2654435769 ) ) >> shift;
+        }
+};
+
 /**
 A generic class to store objects identified by a `string_id`.
 
@@ -164,13 +207,34 @@ class generic_factory
         std::string type_name;
         std::string id_member_name;
 
+        // flat lookup for interned string ids, valid while interned_version == version
+        interned_id_table interned;
+        int64_t interned_version = INVALID_VERSION;
+
+#ifdef CATA_STRING_ID_DEBUGGING
+        // Number of lookups that missed the cached int id of the string_id, per id.
+        // High counts point at temporary string_ids constructed in hot code.
+        mutable std::unordered_map<string_id<T>, int64_t> lookup_misses;
+#endif
+
         bool find_id( const string_id<T> &id, int_id<T> &result ) const {
             if( id._version == version ) {
                 result = int_id<T>( id._cid );
                 return is_valid( result );
             }
+#ifdef CATA_STRING_ID_DEBUGGING
+            ++lookup_misses[id];
+#endif
+            // lookup happens at most once per string_id instance per generic_factory::version
+            if constexpr( !string_id_params<T>::dynamic ) {
+                if( interned_version == version ) {
+                    const int cid = interned.find( id._id._id );
+                    id.set_cid_version( cid, version );
+                    result = int_id<T>( cid );
+                    return cid != INVALID_CID;
+                }
+            }
             const auto iter = map.find( id );
-            // map lookup happens at most once per string_id instance per generic_factory::version
             // id was not found, explicitly marking it as "invalid"
             if( iter == map.end() ) {
                 id.set_cid_version( INVALID_CID, version );
@@ -181,6 +245,18 @@ class generic_factory
             return true;
         }
 
+        void build_interned_table() {
+            if constexpr( !string_id_params<T>::dynamic ) {
+                std::vector<std::pair<int, int>> entries;
+                entries.reserve( map.size() );
+                for( const std::pair<const string_id<T>, int_id<T>> &elem : map ) {
+                    entries.emplace_back( elem.first._id._id, elem.second.to_i() );
+                }
+                interned.build( entries );
+                interned_version = version;
+            }
+        }
+
         const T dummy_obj;
 
     public:
@@ -422,6 +498,7 @@ class generic_factory
                     list[i].finalize();
                 }
             }
+            build_interned_table();
         }
 
         /**
@@ -456,7 +533,25 @@ class generic_factory
             deferred.clear();
             list.clear();
             map.clear();
+            interned.clear();
             inc_version();
+#ifdef CATA_STRING_ID_DEBUGGING
+            lookup_misses.clear();
+#endif
+        }
+        /**
+         * Returns the ids whose lookups missed the int id cached in the string_id, with the
+         * number of misses, most missed first. Always empty if CATA_STRING_ID_DEBUGGING is off.
+         */
+        std::vector<std::pair<string_id<T>, int64_t>> get_lookup_misses() const {
+            std::vector<std::pair<string_id<T>, int64_t>> ret;
+#ifdef CATA_STRING_ID_DEBUGGING
+            ret.assign( lookup_misses.begin(), lookup_misses.end() );
+            std::sort( ret.begin(), ret.end(), []( const auto & l, const auto & r ) {
+                return l.second > r.second;
+            } );
+#endif
+            return ret;
         }
         /**
          * Returns all the loaded objects. It can be used to iterate over them.
@@ -3,42 +3,43 @@
 #define CATA_SRC_GLOBAL_VARS_H
 
 #include "math_parser_diag_value.h"
+#include "var_key.h"
 
 #include "json.h"
 
 class global_variables
 {
     public:
-        using impl_t = std::unordered_map<std::string, diag_value>;
+        using impl_t = std::unordered_map<var_key, diag_value>;
 
         // Methods for setting/getting misc key/value pairs.
-        void set_global_value( const std::string &key, diag_value value ) {
+        void set_global_value( const var_key &key, diag_value value ) {
             global_values[ key ] = std::move( value );
         }
 
         template <typename... Args>
-        void set_global_value( const std::string &key, Args... args ) {
+        void set_global_value( const var_key &key, Args... args ) {
             set_global_value( key, diag_value{ std::forward<Args>( args )... } );
         }
 
-        void remove_global_value( const std::string &key ) {
+        void remove_global_value( const var_key &key ) {
             global_values.erase( key );
         }
 
-        diag_value const *maybe_get_global_value( const std::string &key ) const {
+        diag_value const *maybe_get_global_value( const var_key &key ) const {
             return _common_maybe_get_value( key, global_values );
         }
 
-        diag_value const &get_global_value( const std::string &key ) const {
+        diag_value const &get_global_value( const var_key &key ) const {
             return _common_get_value( key, global_values );
         }
 
-        static diag_value const *_common_maybe_get_value( const std::string &key, const impl_t &cont ) {
+        static diag_value const *_common_maybe_get_value( const var_key &key, const impl_t &cont ) {
             auto it = cont.find( key );
             return it == cont.end() ? nullptr : &it->second;
         }
 
-        static diag_value const &_common_get_value( const std::string &key, const impl_t &cont ) {
+        static diag_value const &_common_get_value( const var_key &key, const impl_t &cont ) {
             static diag_value const null_val;
             diag_value const *ret = _common_maybe_get_value( key, cont );
             return ret ? *ret : null_val;
@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <set>
@@ -948,12 +950,12 @@ bool item::merge_charges( const item &rhs )
     return true;
 }
 
-void item::set_var( const std::string &key, diag_value value )
+void item::set_var( const var_key &key, diag_value value )
 {
     item_vars[ key ] = std::move( value );
 }
 
-double item::get_var( const std::string &key, double default_value ) const
+double item::get_var( const var_key &key, double default_value ) const
 {
     if( diag_value const *ret = maybe_get_value( key ); ret ) {
         return ret->dbl();
@@ -962,7 +964,7 @@ double item::get_var( const std::string &key, double default_value ) const
     return default_value;
 }
 
-std::string item::get_var( const std::string &key, std::string default_value ) const
+std::string item::get_var( const var_key &key, std::string default_value ) const
 {
     if( diag_value const *ret = maybe_get_value( key ); ret ) {
         return ret->str();
@@ -971,7 +973,7 @@ std::string item::get_var( const std::string &key, std::string default_value ) c
     return default_value;
 }
 
-tripoint_abs_ms item::get_var( const std::string &key, tripoint_abs_ms default_value ) const
+tripoint_abs_ms item::get_var( const var_key &key, tripoint_abs_ms default_value ) const
 {
     if( diag_value const *ret = maybe_get_value( key ); ret ) {
         return ret->tripoint();
@@ -980,28 +982,28 @@ tripoint_abs_ms item::get_var( const std::string &key, tripoint_abs_ms default_v
     return default_value;
 }
 
-void item::remove_var( const std::string &key )
+void item::remove_var( const var_key &key )
 {
     item_vars.erase( key );
 }
 
-diag_value const &item::get_value( const std::string &name ) const
+diag_value const &item::get_value( const var_key &name ) const
 {
     return global_variables::_common_get_value( name, item_vars );
 
 }
 
-diag_value const *item::maybe_get_value( const std::string &name ) const
+diag_value const *item::maybe_get_value( const var_key &name ) const
 {
     return global_variables::_common_maybe_get_value( name, item_vars );
 }
 
-bool item::has_var( const std::string &name ) const
+bool item::has_var( const var_key &name ) const
 {
     return item_vars.count( name ) > 0;
 }
 
-void item::erase_var( const std::string &name )
+void item::erase_var( const var_key &name )
 {
     item_vars.erase( name );
 }
@@ -1407,6 +1409,7 @@ void item::update_inherited_flags()
             }
         }
     }
+    update_tags_bloom();
 
     // ensure efiles in device can be used in darkness if edevice can be used in darkness
     if( has_flag( flag_CAN_USE_IN_DARK ) ) {
@@ -2057,45 +2060,63 @@ int item::lift_strength() const
     return std::max( mass / 10000, 1 );
 }
 
+static uint64_t tags_bloom_bit( const flag_id &f )
+{
+    return uint64_t{ 1 } << ( std::hash<flag_id>()( f ) % 64 );
+}
+
+void item::update_tags_bloom()
+{
+    tags_bloom = 0;
+    for( const flag_id &f : item_tags ) {
+        tags_bloom |= tags_bloom_bit( f );
+    }
+    for( const flag_id &f : inherited_tags_cache ) {
+        tags_bloom |= tags_bloom_bit( f );
+    }
+}
+
 void item::unset_flags()
 {
     item_tags.clear();
+    update_tags_bloom();
     requires_tags_processing = true;
 }
 
 bool item::has_own_flag( const flag_id &f ) const
 {
+    if( !( tags_bloom & tags_bloom_bit( f ) ) ) {
+        return false;
+    }
     return item_tags.find( f ) != item_tags.end();
 }
 
 bool item::has_flag( const flag_id &f ) const
 {
-    bool ret = false;
     if( !f.is_valid() ) {
         debugmsg( "Attempted to check invalid flag_id %s", f.str() );
         return false;
     }
 
-    ret = inherited_tags_cache.find( f ) != inherited_tags_cache.end();
-    if( ret ) {
-        return ret;
+    // item type flags
+    if( type->has_flag( f ) ) {
+        return true;
     }
 
-    // other item type flags
-    ret = type->has_flag( f );
-    if( ret ) {
-        return ret;
+    // neither inherited nor item specific
+    if( !( tags_bloom & tags_bloom_bit( f ) ) ) {
+        return false;
     }
 
-    // now check for item specific flags
-    ret = has_own_flag( f );
-    return ret;
+    return inherited_tags_cache.find( f ) != inherited_tags_cache.end() ||
+           item_tags.find( f ) != item_tags.end();
 }
 
 item &item::set_flag( const flag_id &flag )
 {
     if( flag.is_valid() ) {
         item_tags.insert( flag );
+        tags_bloom |= tags_bloom_bit( flag );
         update_prefix_suffix_flags( flag );
         requires_tags_processing = true;
     } else {
@@ -2125,6 +2146,7 @@ bool item::has_vitamin( const vitamin_id &v ) const
 item &item::unset_flag( const flag_id &flag )
 {
     item_tags.erase( flag );
+    update_tags_bloom();
     update_prefix_suffix_flags();
     requires_tags_processing = true;
     return *this;
@@ -1995,23 +1995,23 @@ class item : public visitable
          * already used somewhere.
          */
         /*@{*/
-        double get_var( const std::string &key, double default_value ) const;
-        std::string get_var( const std::string &key, std::string default_value = {} ) const;
-        tripoint_abs_ms get_var( const std::string &key, tripoint_abs_ms default_value ) const;
+        double get_var( const var_key &key, double default_value ) const;
+        std::string get_var( const var_key &key, std::string default_value = {} ) const;
+        tripoint_abs_ms get_var( const var_key &key, tripoint_abs_ms default_value ) const;
 
-        void set_var( const std::string &key, diag_value value );
+        void set_var( const var_key &key, diag_value value );
         template <typename... Args>
-        void set_var( const std::string &key, Args... args ) {
+        void set_var( const var_key &key, Args... args ) {
             set_var( key, diag_value{ std::forward<Args>( args )... } );
         }
 
-        void remove_var( const std::string &key );
-        diag_value const &get_value( const std::string &name ) const;
-        diag_value const *maybe_get_value( const std::string &name ) const;
+        void remove_var( const var_key &key );
+        diag_value const &get_value( const var_key &name ) const;
+        diag_value const *maybe_get_value( const var_key &name ) const;
         /** Whether the variable is defined at all. */
-        bool has_var( const std::string &name ) const;
+        bool has_var( const var_key &name ) const;
         /** Erase the value of the given variable. */
-        void erase_var( const std::string &name );
+        void erase_var( const var_key &name );
         /** Removes all item variables. */
         void clear_vars();
         /*@}*/
@@ -3141,6 +3141,24 @@ class item : public visitable
         std::list<const item *> all_items_ptr( pocket_type pk_type ) const;
         /** returns a list of pointers to all items inside recursively */
         std::list<item *> all_items_ptr( pocket_type pk_type );
+        /**
+         * Calls @p func on every item inside recursively, in the same order as
+         * all_items_ptr( pk_type ), without building any lists.
+         */
+        template<typename F>
+        void visit_items_top_recursive( pocket_type pk_type, F &&func ) {
+            contents.visit_items_top( pk_type, func );
+            contents.visit_items_top( pk_type, [pk_type, &func]( item & it ) {
+                it.visit_items_top_recursive( pk_type, func );
+            } );
+        }
+        template<typename F>
+        void visit_items_top_recursive( pocket_type pk_type, F &&func ) const {
+            contents.visit_items_top( pk_type, func );
+            contents.visit_items_top( pk_type, [pk_type, &func]( const item & it ) {
+                it.visit_items_top_recursive( pk_type, func );
+            } );
+        }
 
         /** returns a list of pointers to all visible or remembered
         * top-level items in standard pockets */
@@ -3290,6 +3308,13 @@ class item : public visitable
         cata::heap<FlagsSetType> inherited_tags_cache;
         cata::heap<FlagsSetType> prefix_tags_cache; // flags that will add prefixes to this item
         cata::heap<FlagsSetType> suffix_tags_cache; // flags that will add suffixes to this item
+        /**
+         * Bloom filter over item_tags and inherited_tags_cache, one bit per flag hash.
+         * Lets has_flag() reject flags the item itself doesn't have without touching the sets.
+         * Must be updated whenever either set changes, see update_tags_bloom().
+         */
+        uint64_t tags_bloom = 0;
+        void update_tags_bloom();
         lazy<safe_reference_anchor> anchor;
         cata::heap<global_variables::impl_t> item_vars;
         const mtype *corpse = nullptr;
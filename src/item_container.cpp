@@ -981,8 +981,10 @@ std::list<const item *> item::all_items_ptr() const
     std::list<const item *> all_items_internal;
     for( int i = static_cast<int>( pocket_type::CONTAINER );
          i < static_cast<int>( pocket_type::LAST ); i++ ) {
-        std::list<const item *> inserted{ all_items_top_recursive( static_cast<pocket_type>( i ) ) };
-        all_items_internal.insert( all_items_internal.end(), inserted.begin(), inserted.end() );
+        visit_items_top_recursive( static_cast<pocket_type>( i ),
+        [&all_items_internal]( const item & it ) {
+            all_items_internal.push_back( &it );
+        } );
     }
     return all_items_internal;
 }
@@ -992,8 +994,10 @@ std::list<item *> item::all_items_ptr()
     std::list<item *> all_items_internal;
     for( int i = static_cast<int>( pocket_type::CONTAINER );
          i < static_cast<int>( pocket_type::LAST ); i++ ) {
-        std::list<item *> inserted{ all_items_top_recursive( static_cast<pocket_type>( i ) ) };
-        all_items_internal.insert( all_items_internal.end(), inserted.begin(), inserted.end() );
+        visit_items_top_recursive( static_cast<pocket_type>( i ),
+        [&all_items_internal]( item & it ) {
+            all_items_internal.push_back( &it );
+        } );
     }
     return all_items_internal;
 }
@@ -1011,27 +1015,19 @@ std::list<item *> item::all_items_ptr( pocket_type pk_type )
 std::list<const item *> item::all_items_top_recursive( pocket_type pk_type )
 const
 {
-    std::list<const item *> contained = contents.all_items_top( pk_type );
-    std::list<const item *> all_items_internal{ contained };
-    for( const item *it : contained ) {
-        std::list<const item *> recursion_items = it->all_items_top_recursive( pk_type );
-        all_items_internal.insert( all_items_internal.end(), recursion_items.begin(),
-                                   recursion_items.end() );
-    }
-
+    std::list<const item *> all_items_internal;
+    visit_items_top_recursive( pk_type, [&all_items_internal]( const item & it ) {
+        all_items_internal.push_back( &it );
+    } );
     return all_items_internal;
 }
 
 std::list<item *> item::all_items_top_recursive( pocket_type pk_type )
 {
-    std::list<item *> contained = contents.all_items_top( pk_type );
-    std::list<item *> all_items_internal{ contained };
-    for( item *it : contained ) {
-        std::list<item *> recursion_items = it->all_items_top_recursive( pk_type );
-        all_items_internal.insert( all_items_internal.end(), recursion_items.begin(),
-                                   recursion_items.end() );
-    }
-
+    std::list<item *> all_items_internal;
+    visit_items_top_recursive( pk_type, [&all_items_internal]( item & it ) {
+        all_items_internal.push_back( &it );
+    } );
     return all_items_internal;
 }
 
@@ -1889,110 +1889,78 @@ bool item_contents::allows_speedloader( const itype_id &speedloader_id ) const
 std::vector<const item *> item_contents::mods() const
 {
     std::vector<const item *> mods;
-    for( const item_pocket &pocket : contents ) {
-        if( pocket.is_type( pocket_type::MOD ) ) {
-            for( const item *it : pocket.all_items_top() ) {
-                mods.insert( mods.end(), it );
-            }
-        }
-    }
+    visit_items_top( pocket_type::MOD, [&mods]( const item & it ) {
+        mods.insert( mods.end(), &it );
+    } );
     return mods;
 }
 
 std::vector<const item *> item_contents::softwares() const
 {
     std::vector<const item *> softwares;
-    for( const item_pocket &pocket : contents ) {
-        if( pocket.is_type( pocket_type::E_FILE_STORAGE ) ) {
-            for( const item *it : pocket.all_items_top() ) {
-                if( it->is_software() ) {
-                    softwares.insert( softwares.end(), it );
-                }
-            }
+    visit_items_top( pocket_type::E_FILE_STORAGE, [&softwares]( const item & it ) {
+        if( it.is_software() ) {
+            softwares.insert( softwares.end(), &it );
         }
-    }
+    } );
     return softwares;
 }
 
 std::vector<item *> item_contents::ebooks()
 {
     std::vector<item *> ebooks;
-    for( item_pocket &pocket : contents ) {
-        if( pocket.is_type( pocket_type::E_FILE_STORAGE ) ) {
-            for( item *it : pocket.all_items_top() ) {
-                if( it->is_book() ) {
-                    ebooks.emplace_back( it );
-                }
-            }
+    visit_items_top( pocket_type::E_FILE_STORAGE, [&ebooks]( item & it ) {
+        if( it.is_book() ) {
+            ebooks.emplace_back( &it );
         }
-    }
+    } );
     return ebooks;
 }
 
 std::vector<const item *> item_contents::ebooks() const
 {
     std::vector<const item *> ebooks;
-    for( const item_pocket &pocket : contents ) {
-        if( pocket.is_type( pocket_type::E_FILE_STORAGE ) ) {
-            for( const item *it : pocket.all_items_top() ) {
-                if( it->is_book() ) {
-                    ebooks.emplace_back( it );
-                }
-            }
+    visit_items_top( pocket_type::E_FILE_STORAGE, [&ebooks]( const item & it ) {
+        if( it.is_book() ) {
+            ebooks.emplace_back( &it );
         }
-    }
+    } );
     return ebooks;
 }
 
 std::vector<item *> item_contents::efiles()
 {
     std::vector<item *> efiles;
-    for( item_pocket &pocket : contents ) {
-        if( pocket.is_type( pocket_type::E_FILE_STORAGE ) ) {
-            for( item *it : pocket.all_items_top() ) {
-                efiles.emplace_back( it );
-            }
-        }
-    }
+    visit_items_top( pocket_type::E_FILE_STORAGE, [&efiles]( item & it ) {
+        efiles.emplace_back( &it );
+    } );
     return efiles;
 }
 
 std::vector<const item *> item_contents::efiles() const
 {
     std::vector<const item *> efiles;
-    for( const item_pocket &pocket : contents ) {
-        if( pocket.is_type( pocket_type::E_FILE_STORAGE ) ) {
-            for( const item *it : pocket.all_items_top() ) {
-                efiles.emplace_back( it );
-            }
-        }
-    }
+    visit_items_top( pocket_type::E_FILE_STORAGE, [&efiles]( const item & it ) {
+        efiles.emplace_back( &it );
+    } );
     return efiles;
 }
 
 std::vector<item *> item_contents::cables()
 {
     std::vector<item *> cables;
-    for( item_pocket &pocket : contents ) {
-        if( pocket.is_type( pocket_type::CABLE ) ) {
-            for( item *it : pocket.all_items_top() ) {
-                cables.emplace_back( it );
-            }
-        }
-    }
+    visit_items_top( pocket_type::CABLE, [&cables]( item & it ) {
+        cables.emplace_back( &it );
+    } );
     return cables;
 }
 
 std::vector<const item *> item_contents::cables() const
 {
     std::vector<const item *> cables;
-    for( const item_pocket &pocket : contents ) {
-        if( pocket.is_type( pocket_type::CABLE ) ) {
-            for( const item *it : pocket.all_items_top() ) {
-                cables.emplace_back( it );
-            }
-        }
-    }
+    visit_items_top( pocket_type::CABLE, [&cables]( const item & it ) {
+        cables.emplace_back( &it );
+    } );
     return cables;
 }
 
@@ -132,6 +132,24 @@ class item_contents
         /** returns a list of pointers to all top-level items */
         std::list<const item *> all_items_top( pocket_type pk_type ) const;
 
+        /** Calls @p func on each top-level item in pk_type pockets without building a list */
+        template<typename F>
+        void visit_items_top( pocket_type pk_type, F &&func ) {
+            for( item_pocket &pocket : contents ) {
+                if( pocket.is_type( pk_type ) ) {
+                    pocket.visit_items_top( func );
+                }
+            }
+        }
+        template<typename F>
+        void visit_items_top( pocket_type pk_type, F &&func ) const {
+            for( const item_pocket &pocket : contents ) {
+                if( pocket.is_type( pk_type ) ) {
+                    pocket.visit_items_top( func );
+                }
+            }
+        }
+
         /** returns a list of pointers to all top-level items in standard pockets */
         std::list<item *> all_items_top();
         /** returns a list of pointers to all top-level items in standard pockets */
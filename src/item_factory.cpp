@@ -830,6 +830,7 @@ void Item_factory::finalize_post( itype &obj )
         }
         return false;
     } );
+    obj.update_flag_bits();
 
     if( obj.gun && !obj.gunmod && !obj.has_flag( flag_PRIMITIVE_RANGED_WEAPON ) ) {
         const quality_id qual_gun_skill( to_upper_case( obj.gun->skill_used.str() ) );
@@ -429,7 +429,7 @@ void item::debug_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
             info.emplace_back( "BASE", string_format( _( "flags: %s" ), flags_listed ) );
             for( auto const &imap : item_vars ) {
                 info.emplace_back( "BASE",
-                                   string_format( _( "item var: %s, %s" ), imap.first,
+                                   string_format( _( "item var: %s, %s" ), imap.first.str(),
                                                   imap.second.to_string() ) );
             }
 
@@ -168,6 +168,19 @@ class item_pocket
 
         std::list<item *> all_items_top();
         std::list<const item *> all_items_top() const;
+        /** Calls @p func on each top-level item without building a list of pointers */
+        template<typename F>
+        void visit_items_top( F &&func ) {
+            for( item &it : contents ) {
+                func( it );
+            }
+        }
+        template<typename F>
+        void visit_items_top( F &&func ) const {
+            for( const item &it : contents ) {
+                func( it );
+            }
+        }
         std::list<item *> all_items_ptr( pocket_type pk_type );
         std::list<const item *> all_items_ptr( pocket_type pk_type ) const;
 
@@ -10,6 +10,7 @@
 #include "character.h"
 #include "debug.h"
 #include "generic_factory.h"
+#include "int_id.h"
 #include "item.h"
 #include "map.h"
 #include "material.h"
@@ -176,7 +177,28 @@ bool itype::has_use() const
 
 bool itype::has_flag( const flag_id &flag ) const
 {
-    return item_tags.count( flag );
+    if( item_tag_bits.empty() ) {
+        return item_tags.count( flag );
+    }
+    const int idx = flag.id().to_i();
+    return idx >= 0 && static_cast<size_t>( idx ) < item_tag_bits.size() && item_tag_bits[idx];
+}
+
+void itype::update_flag_bits()
+{
+    item_tag_bits.clear();
+    for( const flag_id &f : item_tags ) {
+        const int idx = f.id().to_i();
+        if( idx < 0 ) {
+            // unknown flags are only left in the set, fall back to it
+            item_tag_bits.clear();
+            return;
+        }
+        if( static_cast<size_t>( idx ) >= item_tag_bits.size() ) {
+            item_tag_bits.resize( idx + 1, false );
+        }
+        item_tag_bits[idx] = true;
+    }
 }
 
 const itype::FlagsSetType &itype::get_flags() const
@@ -1453,6 +1453,9 @@ struct itype {
         mtype_id source_monster = mtype_id::NULL_ID();
     private:
         FlagsSetType item_tags;
+        // item_tags indexed by flag int id, so has_flag() is a single bit test.
+        // Built by update_flag_bits() once flags are final, empty before that.
+        std::vector<bool> item_tag_bits;
 
     public:
         // memory card related per-type static data
@@ -1638,6 +1641,9 @@ struct itype {
         // returns read-only set of all item tags/flags
         const FlagsSetType &get_flags() const;
 
+        // rebuilds the flag bitset from item_tags, called by Item_factory after finalization
+        void update_flag_bits();
+
         bool can_use( const std::string &iuse_name ) const;
         const use_function *get_use( const std::string &iuse_name ) const;
         // can use/get_use, but for tick actions
@@ -111,21 +111,27 @@ void kill_tracker::notify( const cata::event &e )
 {
     switch( e.type() ) {
         case event_type::character_kills_monster: {
-            const character_id killer_id = e.get<character_id>( "killer" );
+            constexpr event_type type = event_type::character_kills_monster;
+            const character_id killer_id =
+                e.get<type, cata::event::field_index<type>( "killer" )>();
             if( Character *killer = get_avatar_or_follower( killer_id ) ) {
-                const mtype_id victim_type = e.get<mtype_id>( "victim_type" );
+                const mtype_id victim_type =
+                    e.get<type, cata::event::field_index<type>( "victim_type" )>();
                 kills[victim_type]++;
                 // Legacy value update, maintained until kill_xp rework/removal from dependent in-repo mods
-                killer->kill_xp += e.get<int>( "exp" );
+                killer->kill_xp += e.get<type, cata::event::field_index<type>( "exp" )>();
                 victim_type.obj().families.practice_kill( *killer );
             }
             break;
         }
         case event_type::character_kills_character: {
-            const character_id killer_id = e.get<character_id>( "killer" );
+            constexpr event_type type = event_type::character_kills_character;
+            const character_id killer_id =
+                e.get<type, cata::event::field_index<type>( "killer" )>();
             // player is credited for NPC kills they or their followers make
             if( Character *killer = get_avatar_or_follower( killer_id ) ) {
-                const std::string victim_name = e.get<cata_variant_type::string>( "victim_name" );
+                const std::string victim_name =
+                    e.get<type, cata::event::field_index<type>( "victim_name" )>();
                 npc_kills.push_back( victim_name );
                 // Legacy value update, maintained until kill_xp rework/removal from dependent in-repo mods
                 killer->kill_xp += npc_kill_xp;
@@ -35,6 +35,7 @@
 #include "mtype.h"
 #include "npc.h"
 #include "point.h"
+#include "scratch_vector.h"
 #include "string_formatter.h"
 #include "submap.h"
 #include "tileray.h"
@@ -487,7 +488,8 @@ void map::generate_lightmap( const int zlev )
         apply_character_light( guy );
     }
 
-    std::vector<std::pair<tripoint_bub_ms, float>> lm_override;
+    scratch_vector<std::pair<tripoint_bub_ms, float>> lm_override_buffer;
+    std::vector<std::pair<tripoint_bub_ms, float>> &lm_override = lm_override_buffer.get();
     // Traverse the submaps in order
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
@@ -1092,7 +1094,8 @@ void map::build_seen_cache( const tripoint_bub_ms &origin, const int target_z, i
     vehicle *const veh = &vp->vehicle();
 
     // We're inside a vehicle. Do mirror calculations.
-    std::vector<int> mirrors;
+    scratch_vector<int> mirrors_buffer;
+    std::vector<int> &mirrors = mirrors_buffer.get();
     // Do all the sight checks first to prevent fake multiple reflection
     // from happening due to mirrors becoming visible due to processing order.
     // Cameras are also handled here, so that we only need to get through all vehicle parts once
@@ -2,87 +2,245 @@
 #ifndef CATA_SRC_LRU_CACHE_H
 #define CATA_SRC_LRU_CACHE_H
 
-#include <list>
-#include <unordered_map>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <utility>
+#include <vector>
 
+/**
+ * Cache that forgets the least recently used entry once it holds more than the given limit.
+ *
+ * Entries live in a single vector and are chained into a recency list by index, lookups go
+ * through an open addressing table with linear probing.  Once the cache is full, inserting a
+ * new key reuses the storage of the entry it evicts, so nothing is allocated per insert.
+ */
 template<typename Key, typename Value>
 class lru_cache
 {
     public:
-        using Pair = std::pair<Key, Value>;
-
         Value get( const Key &, const Value &default_ ) const;
         void insert( int limit, const Key &, const Value & );
         void remove( const Key & );
 
         void clear();
-    protected:
-        void trim( int limit );
-        void touch( typename std::list<Pair>::iterator iter ) const;
-        mutable std::list<Pair> ordered_list;
-        std::unordered_map<Key, typename std::list<Pair>::iterator> map;
+        std::size_t size() const {
+            return count;
+        }
+
+    private:
+        static constexpr std::uint32_t none = UINT32_MAX;
+
+        struct entry {
+            Key key;
+            Value value;
+            std::size_t hash = 0;
+            std::uint32_t prev = none;
+            std::uint32_t next = none;
+        };
+
+        static std::size_t hash_of( const Key &key ) {
+            return std::hash<Key> {}( key );
+        }
+        std::size_t bucket_of( std::size_t hash ) const {
+            // Fibonacci hashing, some of the keys (points) have rather weak hashes.
+            const std::uint64_t mixed = static_cast<std::uint64_t>( hash ) *
+                                        UINT64_C( 0x9E3779B97F4A7C15 );
+            return static_cast<std::size_t>( mixed >> 32 ) & ( table.size() - 1 );
+        }
+        // Index of the table slot holding key, or none.
+        std::uint32_t find_slot( const Key &key, std::size_t hash ) const;
+        void unlink( std::uint32_t index ) const;
+        void link_back( std::uint32_t index ) const;
+        void add_to_table( std::uint32_t index );
+        void remove_slot( std::uint32_t slot );
+        void grow();
+
+        mutable std::vector<entry> entries;
+        // Indices into entries, none for empty slots.  Kept at most half full.
+        std::vector<std::uint32_t> table;
+        std::vector<std::uint32_t> free_entries;
+        // Least recently used entry is the head.
+        mutable std::uint32_t head = none;
+        mutable std::uint32_t tail = none;
+        std::size_t count = 0;
 };
 
 template<typename Key, typename Value>
-inline Value lru_cache<Key, Value>::get( const Key &pos, const Value &default_ ) const
+inline std::uint32_t lru_cache<Key, Value>::find_slot( const Key &key, std::size_t hash ) const
 {
-    if( const auto found = this->map.find( pos ); found != this->map.end() ) {
-        const auto list_iter = found->second;
-        this->touch( list_iter );
-        return list_iter->second;
+    if( table.empty() ) {
+        return none;
     }
-    return default_;
+    const std::size_t mask = table.size() - 1;
+    for( std::size_t slot = bucket_of( hash ); table[slot] != none; slot = ( slot + 1 ) & mask ) {
+        const entry &e = entries[table[slot]];
+        if( e.hash == hash && e.key == key ) {
+            return static_cast<std::uint32_t>( slot );
+        }
+    }
+    return none;
 }
 
 template<typename Key, typename Value>
-inline void lru_cache<Key, Value>::remove( const Key &pos )
+inline void lru_cache<Key, Value>::unlink( std::uint32_t index ) const
 {
-    if( const auto found = map.find( pos ); found != map.end() ) {
-        ordered_list.erase( found->second );
-        map.erase( found );
+    entry &e = entries[index];
+    if( e.prev != none ) {
+        entries[e.prev].next = e.next;
+    } else {
+        head = e.next;
+    }
+    if( e.next != none ) {
+        entries[e.next].prev = e.prev;
+    } else {
+        tail = e.prev;
     }
+    e.prev = none;
+    e.next = none;
 }
 
 template<typename Key, typename Value>
-inline void lru_cache<Key, Value>::insert( int limit, const Key &pos, const Value &t )
+inline void lru_cache<Key, Value>::link_back( std::uint32_t index ) const
 {
-    auto found = map.find( pos );
-    if( found == map.end() ) {
-        // Need new entry in map.  Make the new list entry and point to it.
-        ordered_list.emplace_back( pos, t );
-        map.emplace( pos, std::prev( ordered_list.end() ) );
-        trim( limit );
+    entry &e = entries[index];
+    e.prev = tail;
+    e.next = none;
+    if( tail != none ) {
+        entries[tail].next = index;
     } else {
-        // Splice existing entry to the back.  Does not invalidate the
-        // iterator, so no need to change the map.
-        auto list_iterator = found->second;
-        touch( list_iterator );
-        // Update the moved item
-        list_iterator->second = t;
+        head = index;
+    }
+    tail = index;
+}
+
+template<typename Key, typename Value>
+inline void lru_cache<Key, Value>::add_to_table( std::uint32_t index )
+{
+    const std::size_t mask = table.size() - 1;
+    std::size_t slot = bucket_of( entries[index].hash );
+    while( table[slot] != none ) {
+        slot = ( slot + 1 ) & mask;
+    }
+    table[slot] = index;
+}
+
+template<typename Key, typename Value>
+inline void lru_cache<Key, Value>::remove_slot( std::uint32_t slot )
+{
+    // Backward shift deletion: pull later entries of the probe sequence into the gap, so lookups
+    // never have to skip over tombstones.
+    const std::size_t mask = table.size() - 1;
+    std::size_t gap = slot;
+    table[gap] = none;
+    for( std::size_t next = ( gap + 1 ) & mask; table[next] != none; next = ( next + 1 ) & mask ) {
+        const std::size_t ideal = bucket_of( entries[table[next]].hash );
+        if( ( ( next - ideal ) & mask ) >= ( ( next - gap ) & mask ) ) {
+            table[gap] = table[next];
+            table[next] = none;
+            gap = next;
+        }
     }
 }
 
 template<typename Key, typename Value>
-inline void lru_cache<Key, Value>::trim( int limit )
+inline void lru_cache<Key, Value>::grow()
 {
-    while( map.size() > static_cast<size_t>( limit ) ) {
-        map.erase( ordered_list.front().first );
-        ordered_list.pop_front();
+    table.assign( std::max<std::size_t>( 16, table.size() * 2 ), none );
+    for( std::uint32_t index = head; index != none; index = entries[index].next ) {
+        add_to_table( index );
     }
 }
 
 template<typename Key, typename Value>
-inline void lru_cache<Key, Value>::touch( typename std::list<Pair>::iterator iter ) const
+inline Value lru_cache<Key, Value>::get( const Key &pos, const Value &default_ ) const
 {
-    ordered_list.splice( ordered_list.end(), ordered_list, iter );
+    const std::uint32_t slot = find_slot( pos, hash_of( pos ) );
+    if( slot == none ) {
+        return default_;
+    }
+    const std::uint32_t index = table[slot];
+    if( index != tail ) {
+        unlink( index );
+        link_back( index );
+    }
+    return entries[index].value;
+}
+
+template<typename Key, typename Value>
+inline void lru_cache<Key, Value>::remove( const Key &pos )
+{
+    const std::uint32_t slot = find_slot( pos, hash_of( pos ) );
+    if( slot == none ) {
+        return;
+    }
+    const std::uint32_t index = table[slot];
+    remove_slot( slot );
+    unlink( index );
+    // Don't keep whatever the value owns alive.
+    entries[index].value = Value();
+    free_entries.push_back( index );
+    --count;
+}
+
+template<typename Key, typename Value>
+inline void lru_cache<Key, Value>::insert( int limit, const Key &pos, const Value &t )
+{
+    const std::size_t hash = hash_of( pos );
+    const std::uint32_t slot = find_slot( pos, hash );
+    if( slot != none ) {
+        const std::uint32_t index = table[slot];
+        if( index != tail ) {
+            unlink( index );
+            link_back( index );
+        }
+        entries[index].value = t;
+        return;
+    }
+    if( limit <= 0 ) {
+        clear();
+        return;
+    }
+    std::uint32_t index = none;
+    if( count >= static_cast<std::size_t>( limit ) ) {
+        // Full, recycle the least recently used entry.
+        while( count > static_cast<std::size_t>( limit ) ) {
+            remove( entries[head].key );
+        }
+        index = head;
+        remove_slot( find_slot( entries[index].key, entries[index].hash ) );
+        unlink( index );
+        --count;
+    } else if( !free_entries.empty() ) {
+        index = free_entries.back();
+        free_entries.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>( entries.size() );
+        entries.emplace_back();
+    }
+    entry &e = entries[index];
+    e.key = pos;
+    e.value = t;
+    e.hash = hash;
+    link_back( index );
+    ++count;
+    if( count * 2 > table.size() ) {
+        grow();
+    } else {
+        add_to_table( index );
+    }
 }
 
 template<typename Key, typename Value>
 inline void lru_cache<Key, Value>::clear()
 {
-    map.clear();
-    ordered_list.clear();
+    entries.clear();
+    table.clear();
+    free_entries.clear();
+    head = none;
+    tail = none;
+    count = 0;
 }
 
 #endif // CATA_SRC_LRU_CACHE_H
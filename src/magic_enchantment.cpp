@@ -1,5 +1,6 @@
 #include "magic_enchantment.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <string>
@@ -413,6 +414,28 @@ bool enchantment::is_active( const vehicle &veh, const bool active ) const
     return false;
 }
 
+bool enchantment::is_static() const
+{
+    if( active_conditions.second == condition::DIALOG_CONDITION ) {
+        return false;
+    }
+    const auto constant = []( const auto & values ) {
+        return std::all_of( values.begin(), values.end(), []( const auto & value ) {
+            return value.second.is_constant();
+        } );
+    };
+    return constant( values_add ) && constant( values_multiply ) &&
+           constant( skill_values_add ) && constant( skill_values_multiply ) &&
+           constant( encumbrance_values_add ) && constant( encumbrance_values_multiply ) &&
+           constant( damage_values_add ) && constant( damage_values_multiply ) &&
+           constant( armor_values_add ) && constant( armor_values_multiply ) &&
+           constant( extra_damage_add ) && constant( extra_damage_multiply ) &&
+           std::all_of( special_vision_vector.begin(), special_vision_vector.end(),
+    []( const special_vision & vision ) {
+        return vision.range.is_constant();
+    } );
+}
+
 // Returns true if this enchantment is relevant to monsters. Enchantments that are not relevant to monsters are not processed by monsters.
 bool enchantment::is_monster_relevant() const
 {
@@ -198,6 +198,11 @@ class enchantment
 
         bool is_monster_relevant() const;
 
+        // True if neither whether this is active nor its values depend on anything but
+        // whether its source is active, so its contribution can be cached while that stays
+        // the same.
+        bool is_static() const;
+
         // same as above except for vehicles. Much more limited.
         bool is_active( const vehicle &veh, bool active ) const;
 
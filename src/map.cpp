@@ -5,6 +5,7 @@
 #include <climits>
 #include <cmath>
 #include <cstdlib>
+#include <deque>
 #include <optional>
 #include <ostream>
 #include <queue>
@@ -539,6 +540,39 @@ void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint_bub_ms &p
     }
 }
 
+void map::move_vehicle_in_cache( vehicle &veh, std::vector<tripoint_bub_ms> &vacated )
+{
+    std::vector<tripoint_bub_ms> covered;
+    covered.reserve( veh.part_count() );
+    for( const vpart_reference &vpr : veh.get_all_parts_with_fakes() ) {
+        if( vpr.part().removed ) {
+            continue;
+        }
+        const tripoint_bub_ms p = veh.bub_part_pos( *this, vpr.part() );
+        level_cache &ch = get_cache( p.z() );
+        ch.set_veh_cached_parts( p, veh, static_cast<int>( vpr.part_index() ) );
+        if( inbounds( p ) ) {
+            ch.set_veh_exists_at( p, true );
+        }
+        covered.push_back( p );
+    }
+    std::sort( covered.begin(), covered.end() );
+    covered.erase( std::unique( covered.begin(), covered.end() ), covered.end() );
+    std::sort( vacated.begin(), vacated.end() );
+    vacated.erase( std::unique( vacated.begin(), vacated.end() ), vacated.end() );
+
+    for( const tripoint_bub_ms &p : vacated ) {
+        if( !std::binary_search( covered.begin(), covered.end(), p ) ) {
+            clear_vehicle_point_from_cache( &veh, p );
+            set_pathfinding_cache_dirty( p );
+        }
+    }
+    for( const tripoint_bub_ms &p : covered ) {
+        set_transparency_cache_dirty( p );
+        set_pathfinding_cache_dirty( p );
+    }
+}
+
 void map::clear_vehicle_level_caches( )
 {
     for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
@@ -675,13 +709,15 @@ void map::destroy_vehicle( vehicle *veh )
     detach_vehicle( veh );
 }
 
-void map::on_vehicle_moved( const int smz )
+void map::on_vehicle_moved( const int smz, const bool dirty_pathfinding )
 {
     set_outside_cache_dirty( smz );
     set_transparency_cache_dirty( smz );
     set_floor_cache_dirty( smz );
     set_floor_cache_dirty( smz + 1 );
-    set_pathfinding_cache_dirty( smz );
+    if( dirty_pathfinding ) {
+        set_pathfinding_cache_dirty( smz );
+    }
 }
 
 void map::vehmove()
@@ -1635,8 +1671,9 @@ bool map::displace_vehicle( vehicle &veh, const tripoint_rel_ms &dp, const bool
     }
 
     veh.shed_loose_parts( trinary::SOME, this, &dst );
+    std::vector<tripoint_bub_ms> vacated;
     smzs = veh.advance_precalc_mounts( dst_offset, this, src, dp, ramp_offset,
-                                       adjust_pos, parts_to_move );
+                                       adjust_pos, parts_to_move, &vacated );
     veh.update_active_fakes();
 
     if( src_submap != dst_submap ) {
@@ -1647,10 +1684,17 @@ bool map::displace_vehicle( vehicle &veh, const tripoint_rel_ms &dp, const bool
         src_submap->vehicles.erase( src_submap_veh_it );
         invalidate_max_populated_zlev( dst.z() );
     }
+    // Must happen before update_map(), which may shift the map and invalidate the vacated points
+    move_vehicle_in_cache( veh, vacated );
+    const tripoint_abs_sm old_abs_sub = abs_sub;
     if( need_update ) {
         g->update_map( player_character );
     }
-    add_vehicle_to_cache( &veh );
+    // Shifting the map rebuilds its caches from scratch
+    const bool shifted = abs_sub != old_abs_sub;
+    if( shifted ) {
+        add_vehicle_to_cache( &veh );
+    }
 
     if( z_change || src.z() != dst.z() ) {
         if( z_change ) {
@@ -1681,8 +1725,9 @@ bool map::displace_vehicle( vehicle &veh, const tripoint_rel_ms &dp, const bool
 
     veh.zones_dirty = true; // invalidate zone positions
 
+    const bool pathfinding_stale = shifted || z_change != 0 || src.z() != dst.z();
     for( int vsmz : smzs ) {
-        on_vehicle_moved( dst.z() + vsmz );
+        on_vehicle_moved( dst.z() + vsmz, pathfinding_stale );
     }
     return true;
 }
@@ -7497,6 +7542,29 @@ bool map::sees( const tripoint_bub_ms &F, const tripoint_bub_ms &T, const int ra
     return sees( F, T, range, dummy, with_fields );
 }
 
+bool map::sees_between( const Creature &from, const Creature &to, const int range ) const
+{
+    const tripoint_bub_ms F = from.pos_bub( *this );
+    const tripoint_bub_ms T = to.pos_bub( *this );
+    if( std::abs( F.z() - T.z() ) > fov_3d_z_range ||
+        ( range >= 0 && range < rl_dist( F, T ) ) ||
+        !inbounds( T ) ) {
+        return false;
+    }
+    const int from_slot = creature_los.slot( from, from.pos_abs() );
+    const int to_slot = creature_los.slot( to, to.pos_abs() );
+    if( from_slot < 0 || to_slot < 0 ) {
+        return sees( F, T, range );
+    }
+    if( const std::optional<bool> cached = creature_los.get( from_slot, to_slot ) ) {
+        return *cached;
+    }
+    // Range is already checked, and the pair is good for any range within the matrix.
+    const bool visible = sees( F, T, -1 );
+    creature_los.set( from_slot, to_slot, visible );
+    return visible;
+}
+
 // TODO: Change this to a hash function on the map implementation. This will also allow us to
 // account for the complete lack of entropy in the top 16 bits.
 point map::sees_cache_key( const tripoint_bub_ms &from, const tripoint_bub_ms &to ) const
@@ -8344,6 +8412,128 @@ bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type
     return ret;
 }
 
+// @returns whether every submap of the overmap terrain at @ref grid_sm_base is in MAPBUFFER.
+static bool omt_is_generated( const point_abs_sm &grid_sm_base )
+{
+    // It might be possible to just check the (0, 0) submap as we should never have
+    // a case where only one submap is missing from an OMT level.
+    for( int gridx = 0; gridx <= 1; gridx++ ) {
+        for( int gridy = 0; gridy <= 1; gridy++ ) {
+            for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
+                const tripoint grid_pos( gridx, gridy, gridz );
+                if( !MAPBUFFER.submap_exists( grid_sm_base + grid_pos ) ) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Generates all Z levels of the overmap terrain at @ref p into MAPBUFFER.
+// @returns whether mapgen queued a cleanup of the main map.
+static bool generate_omt( const tripoint_abs_omt &p )
+{
+    smallmap tmp_map;
+    swap_map swap( *tmp_map.cast_to_map() );
+    tmp_map.main_cleanup_override( false );
+    tmp_map.generate( p, calendar::turn, true );
+    return tmp_map.is_main_cleanup_queued();
+}
+
+// @returns whether every submap of the overmap terrain at @ref grid_sm_base is loaded.
+// Unlike omt_is_generated this never reads from disk.
+static bool omt_is_loaded( const point_abs_sm &grid_sm_base )
+{
+    for( int gridx = 0; gridx <= 1; gridx++ ) {
+        for( int gridy = 0; gridy <= 1; gridy++ ) {
+            for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
+                const tripoint grid_pos( gridx, gridy, gridz );
+                if( !MAPBUFFER.submap_loaded( grid_sm_base + grid_pos ) ) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static std::deque<tripoint_abs_omt> &mapgen_job_queue()
+{
+    static std::deque<tripoint_abs_omt> jobs;
+    return jobs;
+}
+
+void mapgen_jobs::queue_ahead_of_bubble( const map &bubble, const point_rel_sm &shift )
+{
+    std::deque<tripoint_abs_omt> &jobs = mapgen_job_queue();
+    jobs.clear();
+
+    const tripoint_abs_sm abs_sub = bubble.get_abs_sub();
+    const point_rel_sm last_sm( bubble.getmapsize() - 1, bubble.getmapsize() - 1 );
+    const point_abs_omt min_omt = project_to<coords::omt>( abs_sub.xy() );
+    const point_abs_omt max_omt = project_to<coords::omt>( abs_sub.xy() + last_sm );
+    const point_abs_omt center = midpoint( min_omt, max_omt );
+
+    // Only the row and column of tiles the bubble is moving towards
+    std::vector<tripoint_abs_omt> ahead;
+    const auto queue = [&ahead, &abs_sub]( const point_abs_omt & p ) {
+        if( !omt_is_loaded( project_to<coords::sm>( p ) ) ) {
+            ahead.emplace_back( p, abs_sub.z() );
+        }
+    };
+    const int column = shift.x() > 0 ? max_omt.x() + 1 : min_omt.x() - 1;
+    if( shift.x() != 0 ) {
+        for( int y = min_omt.y() - 1; y <= max_omt.y() + 1; y++ ) {
+            queue( point_abs_omt( column, y ) );
+        }
+    }
+    if( shift.y() != 0 ) {
+        const int row = shift.y() > 0 ? max_omt.y() + 1 : min_omt.y() - 1;
+        for( int x = min_omt.x() - 1; x <= max_omt.x() + 1; x++ ) {
+            if( shift.x() == 0 || x != column ) {
+                queue( point_abs_omt( x, row ) );
+            }
+        }
+    }
+    // Closest first, the bubble is most likely to reach those next
+    std::stable_sort( ahead.begin(), ahead.end(),
+    [&center]( const tripoint_abs_omt & a, const tripoint_abs_omt & b ) {
+        return square_dist( center, a.xy() ) < square_dist( center, b.xy() );
+    } );
+    jobs.insert( jobs.end(), ahead.begin(), ahead.end() );
+}
+
+int mapgen_jobs::run( int max_jobs )
+{
+    std::deque<tripoint_abs_omt> &jobs = mapgen_job_queue();
+    int generated = 0;
+    // Tiles that turn out to be saved are loaded instead, which counts against the limit too.
+    for( int done = 0; done < max_jobs && !jobs.empty(); done++ ) {
+        const tripoint_abs_omt p = jobs.front();
+        jobs.pop_front();
+        // Saved tiles must be loaded rather than generated again
+        if( omt_is_generated( project_to<coords::sm>( p.xy() ) ) ) {
+            continue;
+        }
+        dbg( D_INFO ) << "mapgen_jobs::run generating " << p;
+        // The tile is outside the bubble, so a requested cleanup of the main map can be ignored
+        generate_omt( p );
+        generated++;
+    }
+    return generated;
+}
+
+size_t mapgen_jobs::pending()
+{
+    return mapgen_job_queue().size();
+}
+
+void mapgen_jobs::clear()
+{
+    mapgen_job_queue().clear();
+}
+
 void map::loadn( const point_bub_sm &grid, bool update_vehicles )
 {
     dbg( D_INFO ) << "map::loadn(game[" << g.get() << "], worldx[" << abs_sub.x()
@@ -8353,33 +8543,14 @@ void map::loadn( const point_bub_sm &grid, bool update_vehicles )
     const tripoint_abs_omt grid_abs_omt = project_to<coords::omt>( grid_abs_sub );
     // Get the base submap "grid" is an offset from.
     const tripoint_abs_sm grid_sm_base = project_to<coords::sm>( grid_abs_omt );
-    bool map_incomplete = false;
-
     map &bubble_map = reality_bubble();
 
     bool const main_inbounds =
         this != &bubble_map && bubble_map.inbounds( project_to<coords::ms>( grid_abs_sub ) );
 
-    // It might be possible to just check the (0, 0) submap as we should never have
-    // a case where only one submap is missing from an OMT level.
-    for( int gridx = 0; gridx <= 1; gridx++ ) {
-        for( int gridy = 0; gridy <= 1; gridy++ ) {
-            for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
-                const tripoint grid_pos( gridx, gridy, gridz );
-                if( !MAPBUFFER.submap_exists( grid_sm_base.xy() + grid_pos ) ) {
-                    map_incomplete = true;
-                    break;
-                }
-            }
-        }
-    }
-
-    if( map_incomplete ) {
-        smallmap tmp_map;
-        swap_map swap( *tmp_map.cast_to_map() );
-        tmp_map.main_cleanup_override( false );
-        tmp_map.generate( grid_abs_omt, calendar::turn, true );
-        _main_requires_cleanup |= main_inbounds && tmp_map.is_main_cleanup_queued();
+    if( !omt_is_generated( grid_sm_base.xy() ) ) {
+        const bool cleanup_queued = generate_omt( grid_abs_omt );
+        _main_requires_cleanup |= main_inbounds && cleanup_queued;
 
         for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
             const tripoint_abs_sm pos = {grid_sm_base.xy(), gridz };
@@ -9887,6 +10058,7 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
         skew_vision_cache.clear();
         skew_vision_wo_fields_cache.clear();
     }
+    creature_los.clear();
     avatar &u = get_avatar();
     Character::moncam_cache_t mcache = u.get_active_moncams();
     Character::moncam_cache_t diff;
@@ -10788,6 +10960,12 @@ void map::update_pathfinding_cache( const tripoint_bub_ms &p ) const
         cur_value |= PathfindingFlag::Vehicle;
     }
 
+    // Same as move_cost_ter_furn(), used by vehicle collision checks
+    if( terrain.movecost == 0 || furniture.movecost < 0 ||
+        terrain.movecost + furniture.movecost != 2 ) {
+        cur_value |= PathfindingFlag::Uneven;
+    }
+
     for( const auto &fld : tile.get_field() ) {
         const field_entry &cur = fld.second;
         if( cur.is_dangerous() ) {
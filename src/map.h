@@ -28,6 +28,7 @@
 #include "colony.h"
 #include "coords_fwd.h"
 #include "creature.h"
+#include "creature_los_matrix.h"
 #include "enums.h"
 #include "game_constants.h"
 #include "item.h"
@@ -449,8 +450,10 @@ class map
 
         /**
          * Callback invoked when a vehicle has moved.
+         * @param dirty_pathfinding Whether to dirty the whole z-level of the pathfinding cache,
+         * false if the caller already dirtied the points covered by the vehicle.
          */
-        void on_vehicle_moved( int smz );
+        void on_vehicle_moved( int smz, bool dirty_pathfinding = true );
 
         struct apparent_light_info {
             bool obstructed;
@@ -642,6 +645,11 @@ class map
         */
         bool sees( const tripoint_bub_ms &F, const tripoint_bub_ms &T, int range,
                    bool with_fields = true ) const;
+        /**
+        * Same as `sees( from position, to position, range )`, but the result for the pair is
+        * remembered until one of them moves or the map caches are rebuilt.
+        */
+        bool sees_between( const Creature &from, const Creature &to, int range ) const;
     private:
         /**
          * Don't expose the slope adjust outside map functions.
@@ -764,6 +772,10 @@ class map
         bool place_vehicle( std::unique_ptr<vehicle> &&new_vehicle );
         void add_vehicle_to_cache( vehicle * );
         void clear_vehicle_point_from_cache( vehicle *veh, const tripoint_bub_ms &pt );
+        // Updates the vehicle caches for a vehicle that moved off the vacated points, as a
+        // single delta: points it still covers are overwritten in place, only the points it
+        // left are cleared, and each changed point is dirtied once.
+        void move_vehicle_in_cache( vehicle &veh, std::vector<tripoint_bub_ms> &vacated );
         // clears all vehicle level caches
         void clear_vehicle_level_caches();
         void remove_vehicle_from_cache( vehicle *veh, int zmin = -OVERMAP_DEPTH,
@@ -2158,6 +2170,10 @@ class map
         using lru_cache_t = lru_cache<point, char>;
         mutable lru_cache_t skew_vision_cache;
         mutable lru_cache_t skew_vision_wo_fields_cache;
+        /**
+         * Line of sight between creatures, reset every time the caches are rebuilt.
+         */
+        mutable creature_los_matrix creature_los;
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
@@ -2285,6 +2301,30 @@ bool ter_furn_has_flag( const ter_t &ter, const furn_t &furn, ter_furn_flag flag
 bool generate_uniform( const tripoint_abs_sm &p, const ter_str_id &ter );
 bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type );
 
+/**
+ * Mapgen jobs for the overmap terrain tiles just ahead of the moving reality bubble.
+ * Generating one of them every turn spreads out the cost that would otherwise
+ * be paid all at once when the bubble shifts into a dense area.
+ * Jobs run on the main thread: mapgen lazily creates overmaps, uses the global
+ * RNG and swaps the current map, none of which is safe to do concurrently.
+ */
+namespace mapgen_jobs
+{
+/**
+ * Replace the queued jobs with the tiles in the row and column just outside the bubble in the
+ * direction of @ref shift, skipping tiles that are loaded.  Never reads from disk.
+ */
+void queue_ahead_of_bubble( const map &bubble, const point_rel_sm &shift );
+/**
+ * Take up to @ref max_jobs queued tiles, nearest first, and generate those that have not
+ * been saved before into MAPBUFFER.  Saved ones are loaded instead.
+ * @returns number generated.
+ */
+int run( int max_jobs );
+size_t pending();
+void clear();
+} // namespace mapgen_jobs
+
 /**
 * Tinymap is a small version of the map which covers a single overmap terrain (OMT) tile,
 * which corresponds to 2 * 2 submaps, or 24 * 24 map tiles. In addition to being smaller
@@ -18,6 +18,7 @@
 #include "avatar.h"
 #include "bodypart.h"
 #include "calendar.h"
+#include "cata_small_literal_vector.h"
 #include "cata_utility.h"
 #include "character.h"
 #include "coordinates.h"
@@ -320,7 +321,7 @@ void map::spread_gas( field_entry &cur, const tripoint_bub_ms &p, int percent_sp
 
     auto neighs = get_neighbors( p );
     size_t end_it = static_cast<size_t>( rng( 0, neighs.size() - 1 ) );
-    std::vector<size_t> spread;
+    small_literal_vector<size_t, 8> spread;
     // Then, spread to a nearby point.
     // If not possible (or randomly), try to spread up
     // Wind direction will block the field spreading into the wind.
@@ -340,7 +341,7 @@ void map::spread_gas( field_entry &cur, const tripoint_bub_ms &p, int percent_sp
             std::pair<tripoint_bub_ms, maptile> &n = neighs[ random_entry( spread ) ];
             gas_spread_to( cur, n.second, n.first );
         } else {
-            std::vector<size_t> neighbour_vec;
+            small_literal_vector<size_t, 8> neighbour_vec;
             auto maptiles = get_wind_blockers( winddirection, p );
             // Three map tiles that are facing the wind direction.
             const maptile &remove_tile = std::get<0>( maptiles );
@@ -1139,8 +1140,7 @@ void field_processor_fd_fire( const tripoint_bub_ms &p, field_entry &cur, field_
     maptile remove_tile = std::get<0>( maptiles );
     maptile remove_tile2 = std::get<1>( maptiles );
     maptile remove_tile3 = std::get<2>( maptiles );
-    std::vector<size_t> neighbour_vec;
-    neighbour_vec.reserve( neighs.size() );
+    small_literal_vector<size_t, 8> neighbour_vec;
     size_t end_it = static_cast<size_t>( rng( 0, neighs.size() - 1 ) );
     // Start at end_it + 1, then wrap around until all elements have been processed
     for( size_t i = ( end_it + 1 ) % neighs.size(), count = 0;
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <functional>
@@ -7,7 +8,9 @@
 #include <memory>
 #include <ostream>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "cached_options.h"
 #include "cata_assert.h"
@@ -30,6 +33,8 @@
 const memorized_tile mm_submap::default_tile = {};
 
 static constexpr int MM_SIZE = MAPSIZE * 2;
+// Clean regions beyond this count are dropped from memory, least recently used first.
+static constexpr size_t MM_MAX_RESIDENT_REGIONS = 256;
 
 #define dbg(x) DebugLog((x),D_MMAP) << __FILE__ << ":" << __LINE__ << ": "
 
@@ -62,6 +67,39 @@ struct reg_coord_pair {
     }
 };
 
+namespace
+{
+struct interned_tile_ids {
+    // deque keeps the strings in place, so the views used as keys stay valid
+    std::deque<std::string> ids{ std::string() };
+    std::unordered_map<std::string_view, uint32_t> index{ { std::string_view(), 0 } };
+};
+} // namespace
+
+static interned_tile_ids &get_interned_tile_ids()
+{
+    static interned_tile_ids table;
+    return table;
+}
+
+uint32_t memorized_tile::intern_id( std::string_view id )
+{
+    interned_tile_ids &table = get_interned_tile_ids();
+    const auto it = table.index.find( id );
+    if( it != table.index.end() ) {
+        return it->second;
+    }
+    const uint32_t idx = table.ids.size();
+    const std::string &stored = table.ids.emplace_back( id );
+    table.index.emplace( stored, idx );
+    return idx;
+}
+
+const std::string &memorized_tile::interned_id( uint32_t idx )
+{
+    return get_interned_tile_ids().ids[idx];
+}
+
 mm_submap::mm_submap( bool make_valid ) : valid( make_valid ) {}
 
 bool mm_submap::is_empty() const
@@ -74,6 +112,16 @@ bool mm_submap::is_valid() const
     return valid;
 }
 
+bool mm_submap::is_dirty() const
+{
+    return dirty;
+}
+
+void mm_submap::mark_clean()
+{
+    dirty = false;
+}
+
 const memorized_tile &mm_submap::get_tile( const point_sm_ms &p ) const
 {
     if( tiles.empty() ) {
@@ -90,6 +138,7 @@ void mm_submap::set_tile( const point_sm_ms &p, const memorized_tile &value )
         tiles.resize( SEEX * SEEY, default_tile );
     }
     tiles[p.y() * SEEX + p.x()] = value;
+    dirty = true;
 }
 
 mm_region::mm_region() : submaps( nullptr ) {}
@@ -107,24 +156,37 @@ bool mm_region::is_empty() const
     return true;
 }
 
+bool mm_region::is_dirty() const
+{
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        // NOLINTNEXTLINE(modernize-loop-convert)
+        for( size_t x  = 0; x < MM_REG_SIZE; x++ ) {
+            if( submaps[x][y]->is_dirty() ) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 const std::string &memorized_tile::get_ter_id() const
 {
-    return ter_id.str();
+    return interned_id( ter_id );
 }
 
 const std::string &memorized_tile::get_dec_id() const
 {
-    return dec_id;
+    return interned_id( dec_id );
 }
 
 void memorized_tile::set_ter_id( std::string_view id )
 {
-    ter_id = ter_str_id( id );
+    ter_id = intern_id( id );
 }
 
 void memorized_tile::set_dec_id( std::string_view id )
 {
-    dec_id = id;
+    dec_id = intern_id( id );
 }
 
 int memorized_tile::get_ter_rotation() const
@@ -299,6 +361,7 @@ bool map_memory::prepare_region( const tripoint_abs_ms &p1, const tripoint_abs_m
     cache_pos = sm_pos;
     cache_size = sm_size.raw();
     cached.clear();
+    region_tick++;
     // Loop through each z-level in vision range
     for( int z = std::max( sm_pos.z() - fov_3d_z_range, -OVERMAP_DEPTH );
          z <= std::min( sm_pos.z() + fov_3d_z_range, OVERMAP_HEIGHT ); z++ ) {
@@ -311,11 +374,13 @@ bool map_memory::prepare_region( const tripoint_abs_ms &p1, const tripoint_abs_m
             }
         }
     }
+    evict_regions();
     return true;
 }
 
 shared_ptr_fast<mm_submap> map_memory::fetch_submap( const tripoint_abs_sm &sm_pos )
 {
+    region_last_used[reg_coord_pair( sm_pos ).reg] = region_tick;
     shared_ptr_fast<mm_submap> sm = find_submap( sm_pos );
     if( sm ) {
         return sm;
@@ -411,6 +476,8 @@ shared_ptr_fast<mm_submap> map_memory::load_submap( const tripoint_abs_sm &sm_po
         for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
             const tripoint_abs_sm pos( mmr_to_sm_copy( p.reg ) + tripoint( x, y, 0 ) );
             shared_ptr_fast<mm_submap> &sm = mmr.submaps[x][y];
+            // Freshly loaded tiles match what is on disk
+            sm->mark_clean();
             if( pos == sm_pos ) {
                 ret = sm;
             }
@@ -421,6 +488,51 @@ shared_ptr_fast<mm_submap> map_memory::load_submap( const tripoint_abs_sm &sm_po
     return ret;
 }
 
+void map_memory::evict_regions()
+{
+    if( region_last_used.size() <= MM_MAX_RESIDENT_REGIONS ) {
+        return;
+    }
+    std::vector<std::pair<int64_t, tripoint>> by_age;
+    by_age.reserve( region_last_used.size() );
+    for( const std::pair<const tripoint, int64_t> &it : region_last_used ) {
+        by_age.emplace_back( it.second, it.first );
+    }
+    std::sort( by_age.begin(), by_age.end() );
+
+    size_t resident = region_last_used.size();
+    for( const std::pair<int64_t, tripoint> &it : by_age ) {
+        if( resident <= MM_MAX_RESIDENT_REGIONS ) {
+            break;
+        }
+        const tripoint_abs_sm regp_sm = mmr_to_sm_copy( it.second );
+        const auto can_drop = [&]() {
+            for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+                for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+                    const auto sm = submaps.find( regp_sm + tripoint( x, y, 0 ) );
+                    // Unsaved changes wait for the next save; the render cache holds
+                    // its own reference to submaps in use.
+                    if( sm != submaps.end() && ( sm->second->is_dirty() || sm->second.use_count() > 1 ) ) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+        if( !can_drop() ) {
+            continue;
+        }
+        dbg( D_INFO ) << "Evicting mm_region " << it.second << " [" << regp_sm << "]";
+        for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+            for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+                submaps.erase( regp_sm + tripoint( x, y, 0 ) );
+            }
+        }
+        region_last_used.erase( it.second );
+        resident--;
+    }
+}
+
 static mm_submap null_mz_submap;
 static mm_submap invalid_mz_submap{ false };
 static const tripoint_abs_sm invalid_cache_pos = tripoint_abs_sm::invalid;
@@ -456,11 +568,13 @@ void map_memory::load( const tripoint_abs_ms &pos )
     dbg( D_INFO ) << "[LOAD] Loading memory map around " << p.sm << ". Loading submaps within " << start
                   << "->" << start + tripoint( MM_SIZE, MM_SIZE, 0 );
     clear_cache();
+    region_tick++;
     for( int dy = 0; dy < MM_SIZE; dy++ ) {
         for( int dx = 0; dx < MM_SIZE; dx++ ) {
             fetch_submap( start + tripoint_rel_sm( dx, dy, 0 ) );
         }
     }
+    evict_regions();
     dbg( D_INFO ) << "[LOAD] Done.";
 }
 
@@ -482,6 +596,7 @@ bool map_memory::save( const tripoint_abs_ms &pos )
         regions[p.reg].submaps[p.sm_loc.x()][p.sm_loc.y()] = it.second;
     }
     submaps.clear();
+    region_last_used.clear();
 
     constexpr point MM_HSIZE_P = point( MM_SIZE / 2, MM_SIZE / 2 );
     rectangle<point_abs_sm> rect_keep( sm_center.xy() - MM_HSIZE_P, sm_center.xy() + MM_HSIZE_P );
@@ -499,7 +614,8 @@ bool map_memory::save( const tripoint_abs_ms &pos )
     for( auto &it : regions ) {
         const tripoint &regp = it.first;
         mm_region &reg = it.second;
-        if( !reg.is_empty() ) {
+        // Regions that were not touched since they were loaded are already on disk
+        if( !reg.is_empty() && reg.is_dirty() ) {
             const std::filesystem::path mm_filename = std::filesystem::u8path( find_region_filename( regp ) );
             const std::string descr = string_format(
                                           _( "memory map region for (%d,%d,%d)" ),
@@ -509,21 +625,24 @@ bool map_memory::save( const tripoint_abs_ms &pos )
                 reg.serialize( jsout );
             } );
 
+            bool written = false;
             if( world_generator->active_world->has_compression_enabled() ) {
-                if( z ) {
-                    result = z->add_file( mm_filename, mm_str ) && result;
-                } else {
-                    result = false;
-                }
-
+                written = z && z->add_file( mm_filename, mm_str );
             } else {
                 const cata_path path = dirname / mm_filename;
                 const auto writer = [&]( std::ostream & fout ) -> void {
                     fout << mm_str;
                 };
 
-                const bool res = write_to_file( path, writer, descr.c_str() );
-                result = result && res;
+                written = write_to_file( path, writer, descr.c_str() );
+            }
+            result = result && written;
+            if( written ) {
+                for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+                    for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+                        reg.submaps[x][y]->mark_clean();
+                    }
+                }
             }
         }
         const tripoint_abs_sm regp_sm( mmr_to_sm_copy( regp ) );
@@ -541,6 +660,7 @@ bool map_memory::save( const tripoint_abs_ms &pos )
                     submaps.insert( std::make_pair( p, sm ) );
                 }
             }
+            region_last_used[regp] = region_tick;
         } else {
             dbg( D_INFO ) << "Dropping mm_region " << regp << " [" << regp_sm << "]";
         }
@@ -558,6 +678,7 @@ void map_memory::clear()
 {
     clear_cache();
     submaps.clear();
+    region_last_used.clear();
     dbg( D_INFO ) << "[CLEAR] Done.";
 }
 void map_memory::clear_cache()
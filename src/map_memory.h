@@ -6,6 +6,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "coordinates.h"
@@ -45,8 +46,16 @@ class memorized_tile
         }
     private:
         friend struct mm_submap; // serialization needs access to private members
-        ter_str_id ter_id;       // terrain tile id
-        std::string dec_id;      // decoration tile id (furniture, vparts ...)
+        friend struct mm_region;
+        /**
+         * Ids are interned in a table shared by all of map memory, so a tile only
+         * stores two indices into it. 0 is the empty id.
+         */
+        static uint32_t intern_id( std::string_view id );
+        static const std::string &interned_id( uint32_t idx );
+
+        uint32_t ter_id = 0;     // terrain tile id
+        uint32_t dec_id = 0;     // decoration tile id (furniture, vparts ...)
         int8_t ter_rotation = 0;
         int8_t dec_rotation = 0;
         int8_t ter_subtile = 0;
@@ -66,17 +75,29 @@ struct mm_submap {
         // @returns true if mm_submap is valid, i.e. not returned from an uninitialized region.
         bool is_valid() const;
 
+        // @returns true if mm_submap was modified since it was loaded or last saved.
+        bool is_dirty() const;
+        void mark_clean();
+
         const memorized_tile &get_tile( const point_sm_ms &p ) const;
         void set_tile( const point_sm_ms &p, const memorized_tile &value );
 
-        void serialize( JsonOut &jsout ) const;
-        void deserialize( int version, const JsonArray &ja );
+        /**
+         * @param palette maps interned ids to their index in the region palette,
+         * new ids are appended to it.
+         */
+        void serialize( JsonOut &jsout, std::vector<uint32_t> &palette,
+                        std::unordered_map<uint32_t, uint32_t> &palette_index ) const;
+        /** @param palette interned ids of the region palette, used since version 2 */
+        void deserialize( int version, const JsonArray &ja, const std::vector<uint32_t> &palette );
 
     private:
         // NOLINTNEXTLINE(cata-serialize)
         std::vector<memorized_tile> tiles; // holds either 0 or SEEX*SEEY elements
         // NOLINTNEXTLINE(cata-serialize)
         bool valid = true;
+        // NOLINTNEXTLINE(cata-serialize)
+        bool dirty = false;
 };
 
 /**
@@ -90,6 +111,7 @@ struct mm_region {
     mm_region();
 
     bool is_empty() const;
+    bool is_dirty() const;
 
     void serialize( JsonOut &jsout ) const;
     void deserialize( const JsonValue &ja );
@@ -170,6 +192,9 @@ class map_memory
 
     private:
         std::map<tripoint_abs_sm, shared_ptr_fast<mm_submap>> submaps;
+        /** Resident regions and the tick at which each was last fetched from, for eviction. */
+        std::map<tripoint, int64_t> region_last_used;
+        int64_t region_tick = 0;
 
         mutable std::map<int, std::vector<shared_ptr_fast<mm_submap>>> cached;
         tripoint_abs_sm cache_pos;
@@ -183,6 +208,12 @@ class map_memory
         shared_ptr_fast<mm_submap> load_submap( const tripoint_abs_sm &sm_pos );
         /** Allocate empty submap. @returns the submap. */
         shared_ptr_fast<mm_submap> allocate_submap( const tripoint_abs_sm &sm_pos );
+        /**
+         * Drop least recently used regions that have no unsaved changes and are not
+         * in the render cache, until at most MM_MAX_RESIDENT_REGIONS remain.
+         * Dropped regions are loaded back from disk on demand.
+         */
+        void evict_regions();
 
         /** Get submap from within the cache */
         //@{
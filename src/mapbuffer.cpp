@@ -1,7 +1,10 @@
 #include "mapbuffer.h"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <filesystem>
 #include <functional>
@@ -25,6 +28,7 @@
 #include "json.h"
 #include "json_loader.h"
 #include "map.h"
+#include "options.h"
 #include "output.h"
 #include "overmapbuffer.h"
 #include "path_info.h"
@@ -46,6 +50,222 @@ static std::string quad_file_name( const tripoint_abs_omt &om_addr )
     return string_format( "%d.%d.%d.map", om_addr.x(), om_addr.y(), om_addr.z() );
 }
 
+static std::string binary_quad_file_name( const tripoint_abs_omt &om_addr )
+{
+    return string_format( "%d.%d.%d.mapb", om_addr.x(), om_addr.y(), om_addr.z() );
+}
+
+// Binary quads start with a header: magic, format version and payload size.  The payload holds,
+// per submap, its position and save version, its terrain and furniture as indices into palettes
+// of the ids used, and the remaining members as json.  All numbers are little endian.
+static constexpr std::array<char, 4> binary_quad_magic = { 'C', 'S', 'M', 'B' };
+static constexpr uint32_t binary_quad_version = 2;
+static constexpr size_t binary_quad_header_size = 4 + 4 + 8;
+
+namespace
+{
+
+class binary_quad_writer
+{
+    public:
+        void write( uint64_t value, int bytes ) {
+            for( int i = 0; i < bytes; ++i ) {
+                out.push_back( static_cast<char>( ( value >> ( 8 * i ) ) & 0xff ) );
+            }
+        }
+        void write_int( int value ) {
+            write( static_cast<uint32_t>( value ), 4 );
+        }
+        void write_string( std::string_view str ) {
+            write( str.size(), 4 );
+            out.append( str );
+        }
+        template<typename Id>
+        void write_palette( const std::vector<Id> &palette,
+                            const cata::mdarray<uint16_t, point_sm_ms> &indices ) {
+            write( palette.size(), 2 );
+            for( const Id &id : palette ) {
+                write_string( id.str() );
+            }
+            for( int j = 0; j < SEEY; j++ ) {
+                for( int i = 0; i < SEEX; i++ ) {
+                    write( indices[i][j], 2 );
+                }
+            }
+        }
+
+        std::string out;
+};
+
+// Every read is bounds checked, so truncated or corrupt files throw instead of being read past
+// their end.
+class binary_quad_reader
+{
+    public:
+        explicit binary_quad_reader( std::string_view data ) : data( data ) {}
+
+        uint64_t read( int bytes ) {
+            require( bytes );
+            uint64_t ret = 0;
+            for( int i = 0; i < bytes; ++i ) {
+                const uint64_t byte = static_cast<unsigned char>( data[pos++] );
+                ret |= byte << ( 8 * i );
+            }
+            return ret;
+        }
+        int read_int() {
+            return static_cast<int32_t>( static_cast<uint32_t>( read( 4 ) ) );
+        }
+        std::string_view read_string() {
+            const uint64_t size = read( 4 );
+            require( size );
+            std::string_view ret = data.substr( pos, size );
+            pos += size;
+            return ret;
+        }
+        template<typename Id>
+        void read_palette( std::vector<Id> &palette,
+                           cata::mdarray<uint16_t, point_sm_ms> &indices ) {
+            palette.resize( read( 2 ) );
+            for( Id &id : palette ) {
+                id = Id( std::string( read_string() ) );
+            }
+            for( int j = 0; j < SEEY; j++ ) {
+                for( int i = 0; i < SEEX; i++ ) {
+                    indices[i][j] = static_cast<uint16_t>( read( 2 ) );
+                    if( indices[i][j] >= palette.size() ) {
+                        throw std::runtime_error( "corrupt binary submap quad: bad palette index" );
+                    }
+                }
+            }
+        }
+        bool at_end() const {
+            return pos == data.size();
+        }
+
+    private:
+        void require( uint64_t bytes ) const {
+            if( bytes > data.size() - pos ) {
+                throw std::runtime_error( "truncated binary submap quad" );
+            }
+        }
+
+        std::string_view data;
+        size_t pos = 0;
+};
+
+} // namespace
+
+std::string mapbuffer::encode_binary_quad(
+    const std::vector<std::pair<tripoint_abs_sm, const submap *>> &quad )
+{
+    binary_quad_writer payload;
+    payload.write( quad.size(), 4 );
+    submap_ter_furn ter_furn;
+    for( const std::pair<tripoint_abs_sm, const submap *> &entry : quad ) {
+        payload.write_int( entry.first.x() );
+        payload.write_int( entry.first.y() );
+        payload.write_int( entry.first.z() );
+        payload.write_int( savegame_version );
+
+        entry.second->store( ter_furn );
+        payload.write_palette( ter_furn.ter_palette, ter_furn.ter );
+        payload.write_palette( ter_furn.furn_palette, ter_furn.furn );
+
+        std::ostringstream members;
+        JsonOut jsout( members );
+        jsout.start_object();
+        entry.second->store( jsout, false );
+        jsout.end_object();
+        payload.write_string( members.str() );
+    }
+
+    binary_quad_writer out;
+    out.out.append( binary_quad_magic.data(), binary_quad_magic.size() );
+    out.write( binary_quad_version, 4 );
+    out.write( payload.out.size(), 8 );
+    out.out += payload.out;
+    return std::move( out.out );
+}
+
+static mapbuffer::quad_submaps decode_json_quad( const JsonArray &ja )
+{
+    mapbuffer::quad_submaps quad;
+    for( JsonObject submap_json : ja ) {
+        std::unique_ptr<submap> sm = std::make_unique<submap>();
+        tripoint_abs_sm submap_coordinates;
+        int version = 0;
+        // We have to read version first because the iteration order of json members is undefined.
+        if( submap_json.has_int( "version" ) ) {
+            version = submap_json.get_int( "version" );
+        }
+        for( JsonMember submap_member : submap_json ) {
+            std::string submap_member_name = submap_member.name();
+            if( submap_member_name == "coordinates" ) {
+                JsonArray coords_array = submap_member;
+                tripoint_abs_sm loc{ coords_array.next_int(), coords_array.next_int(), coords_array.next_int() };
+                submap_coordinates = loc;
+            } else {
+                sm->load( submap_member, submap_member_name, version );
+            }
+        }
+        quad.emplace_back( submap_coordinates, std::move( sm ) );
+    }
+    return quad;
+}
+
+static mapbuffer::quad_submaps decode_binary_quad( std::string_view data )
+{
+    binary_quad_reader header( data.substr( 0, binary_quad_header_size ) );
+    header.read( 4 );
+    const uint64_t version = header.read( 4 );
+    if( version != binary_quad_version ) {
+        throw std::runtime_error( string_format( "unsupported binary submap quad version %d",
+                                  static_cast<int>( version ) ) );
+    }
+    const uint64_t payload_size = header.read( 8 );
+    if( payload_size != data.size() - binary_quad_header_size ) {
+        throw std::runtime_error( "truncated binary submap quad" );
+    }
+
+    binary_quad_reader payload( data.substr( binary_quad_header_size ) );
+    const uint64_t count = payload.read( 4 );
+    if( count > 4 ) {
+        throw std::runtime_error( "corrupt binary submap quad: too many submaps" );
+    }
+    mapbuffer::quad_submaps quad;
+    submap_ter_furn ter_furn;
+    for( uint64_t n = 0; n < count; ++n ) {
+        const int x = payload.read_int();
+        const int y = payload.read_int();
+        const int z = payload.read_int();
+        const int version = payload.read_int();
+        payload.read_palette( ter_furn.ter_palette, ter_furn.ter );
+        payload.read_palette( ter_furn.furn_palette, ter_furn.furn );
+        JsonObject members = json_loader::from_string( std::string( payload.read_string() ) );
+
+        std::unique_ptr<submap> sm = std::make_unique<submap>();
+        sm->load( ter_furn );
+        for( JsonMember member : members ) {
+            sm->load( member, member.name(), version );
+        }
+        quad.emplace_back( tripoint_abs_sm( x, y, z ), std::move( sm ) );
+    }
+    if( !payload.at_end() ) {
+        throw std::runtime_error( "corrupt binary submap quad: trailing data" );
+    }
+    return quad;
+}
+
+mapbuffer::quad_submaps mapbuffer::decode_quad( std::string_view data )
+{
+    if( data.size() >= binary_quad_magic.size() &&
+        std::equal( binary_quad_magic.begin(), binary_quad_magic.end(), data.begin() ) ) {
+        return decode_binary_quad( data );
+    }
+    return decode_json_quad( json_loader::from_string( std::string( data ) ) );
+}
+
 static cata_path find_dirname( const tripoint_abs_omt &om_addr )
 {
     const tripoint_abs_seg segment_addr = project_to<coords::seg>( om_addr );
@@ -63,6 +283,8 @@ mapbuffer::~mapbuffer() = default;
 void mapbuffer::clear()
 {
     submaps.clear();
+    // Queued jobs belong to the world that is being unloaded
+    mapgen_jobs::clear();
 }
 
 void mapbuffer::clear_outside_reality_bubble()
@@ -129,6 +351,12 @@ submap *mapbuffer::lookup_submap( const tripoint_abs_sm &p )
     return iter->second.get();
 }
 
+bool mapbuffer::submap_loaded( const tripoint_abs_sm &p ) const
+{
+    const auto iter = submaps.find( p );
+    return iter != submaps.end() && iter->second != nullptr;
+}
+
 bool mapbuffer::submap_exists( const tripoint_abs_sm &p )
 {
     // Could so with a second check against a std::unordered_set<tripoint_abs_sm> of already checked existing but not loaded submaps before resorting to unserializing?
@@ -153,6 +381,7 @@ bool mapbuffer::submap_exists_approx( const tripoint_abs_sm &p )
             const tripoint_abs_omt om_addr = project_to<coords::omt>( p );
             const cata_path dirname = find_dirname( om_addr );
             std::string file_name = quad_file_name( om_addr );
+            std::string binary_file_name = binary_quad_file_name( om_addr );
 
             if( world_generator->active_world->has_compression_enabled() ) {
                 cata_path zzip_name = dirname;
@@ -162,9 +391,10 @@ bool mapbuffer::submap_exists_approx( const tripoint_abs_sm &p )
                 }
                 std::optional<zzip> z = zzip::load( zzip_name.get_unrelative_path(),
                                                     ( PATH_INFO::world_base_save_path() / "maps.dict" ).get_unrelative_path() );
-                return z && z->has_file( std::filesystem::u8path( file_name ) );
+                return z && ( z->has_file( std::filesystem::u8path( binary_file_name ) ) ||
+                              z->has_file( std::filesystem::u8path( file_name ) ) );
             } else {
-                return file_exist( dirname / file_name );
+                return file_exist( dirname / binary_file_name ) || file_exist( dirname / file_name );
             }
         } catch( const std::exception &err ) {
             debugmsg( "Failed to load submap %s: %s", p.to_string(), err.what() );
@@ -247,6 +477,14 @@ void mapbuffer::save_quad(
     bool reverted_to_uniform = false;
     bool file_exists = false;
 
+    // Quads are written in the format picked by the option and the copy in the other format,
+    // if any, is removed, so a world migrates either way as its quads get saved.
+    const bool save_binary = get_option<bool>( "BINARY_SUBMAP_SAVES" );
+    const cata_path binary_filename = dirname / binary_quad_file_name( om_addr );
+    const cata_path &target_filename = save_binary ? binary_filename : filename;
+    const cata_path &other_filename = save_binary ? filename : binary_filename;
+    bool other_file_exists = false;
+
     std::optional<zzip> z;
     cata_path zzip_name = dirname;
     zzip_name += ".zzip";
@@ -260,10 +498,13 @@ void mapbuffer::save_quad(
             throw std::runtime_error( "Failed opening compressed save file " +
                                       zzip_name.get_unrelative_path().generic_u8string() );
         }
-        file_exists = z->has_file( filename.get_relative_path().filename() );
+        file_exists = z->has_file( target_filename.get_relative_path().filename() );
+        other_file_exists = z->has_file( other_filename.get_relative_path().filename() );
     } else {
-        file_exists = std::filesystem::exists( filename.get_unrelative_path() );
+        file_exists = std::filesystem::exists( target_filename.get_unrelative_path() );
+        other_file_exists = std::filesystem::exists( other_filename.get_unrelative_path() );
     }
+    file_exists = file_exists || other_file_exists;
 
     for( point_rel_sm &offsets_offset : offsets ) {
         tripoint_abs_sm submap_addr = project_to<coords::sm>( om_addr );
@@ -296,9 +537,7 @@ void mapbuffer::save_quad(
         }
     }
 
-    std::stringstream stringout;
-    JsonOut jsout( stringout );
-    jsout.start_array();
+    std::vector<std::pair<tripoint_abs_sm, const submap *>> quad;
     for( auto &submap_addr : submap_addrs ) {
         if( submaps.count( submap_addr ) == 0 ) {
             continue;
@@ -310,45 +549,62 @@ void mapbuffer::save_quad(
             continue;
         }
 
-        jsout.start_object();
+        quad.emplace_back( submap_addr, sm );
 
-        jsout.member( "version", savegame_version );
-        jsout.member( "coordinates" );
+        if( delete_after_save ) {
+            submaps_to_delete.push_back( submap_addr );
+        }
+    }
 
+    std::string s;
+    if( save_binary ) {
+        s = encode_binary_quad( quad );
+    } else {
+        std::stringstream stringout;
+        JsonOut jsout( stringout );
         jsout.start_array();
-        jsout.write( submap_addr.x() );
-        jsout.write( submap_addr.y() );
-        jsout.write( submap_addr.z() );
-        jsout.end_array();
+        for( const std::pair<tripoint_abs_sm, const submap *> &entry : quad ) {
+            jsout.start_object();
 
-        sm->store( jsout );
+            jsout.member( "version", savegame_version );
+            jsout.member( "coordinates" );
 
-        jsout.end_object();
+            jsout.start_array();
+            jsout.write( entry.first.x() );
+            jsout.write( entry.first.y() );
+            jsout.write( entry.first.z() );
+            jsout.end_array();
 
-        if( delete_after_save ) {
-            submaps_to_delete.push_back( submap_addr );
+            entry.second->store( jsout );
+
+            jsout.end_object();
         }
+        jsout.end_array();
+        s = std::move( stringout ).str();
     }
 
-    jsout.end_array();
-
-    std::string s = std::move( stringout ).str();
-
     if( z ) {
-        z->add_file( filename.get_relative_path().filename(), s );
+        z->add_file( target_filename.get_relative_path().filename(), s );
     } else {
         // Don't create the directory if it would be empty
         assure_dir_exist( dirname );
-        write_to_file( filename, [&]( std::ostream & fout ) {
+        write_to_file( target_filename, [&]( std::ostream & fout ) {
             fout << s;
         } );
     }
 
+    if( other_file_exists ) {
+        if( z ) {
+            z->delete_files( { other_filename.get_relative_path().filename() } );
+        } else {
+            std::filesystem::remove( other_filename.get_unrelative_path() );
+        }
+    }
     if( all_uniform && reverted_to_uniform ) {
         if( z ) {
-            z->delete_files( { filename.get_relative_path().filename() } );
+            z->delete_files( { target_filename.get_relative_path().filename() } );
         } else {
-            std::filesystem::remove( filename.get_unrelative_path() );
+            std::filesystem::remove( target_filename.get_unrelative_path() );
         }
     }
     if( z ) {
@@ -370,6 +626,9 @@ submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
     std::string file_name = quad_file_name( om_addr );
     std::filesystem::path file_name_path = std::filesystem::u8path( file_name );
     cata_path quad_path = dirname / file_name;
+    std::string binary_file_name = binary_quad_file_name( om_addr );
+    std::filesystem::path binary_file_name_path = std::filesystem::u8path( binary_file_name );
+    cata_path binary_quad_path = dirname / binary_file_name;
 
     bool read = [&] {
         if( world_generator->active_world->has_compression_enabled() )
@@ -381,16 +640,34 @@ submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
             }
             std::optional<zzip> z = zzip::load( zzip_name.get_unrelative_path(),
                                                 ( PATH_INFO::world_base_save_path() / "maps.dict" ).get_unrelative_path() );
-            if( !z || !z->has_file( file_name_path ) ) {
+            if( !z ) {
+                return false;
+            }
+            const bool binary = z->has_file( binary_file_name_path );
+            if( !binary && !z->has_file( file_name_path ) ) {
                 return false;
             }
-            std::vector<std::byte> contents = z->get_file( file_name_path );
+            std::vector<std::byte> contents = z->get_file( binary ? binary_file_name_path : file_name_path );
             std::string_view string_contents{ reinterpret_cast<char *>( contents.data() ), contents.size() };
-            JsonValue jsin = json_loader::from_string( std::string( string_contents ) );
             try {
-                deserialize( jsin );
+                add_submaps( decode_quad( string_contents ) );
+            } catch( std::exception &err ) {
+                debugmsg( _( "Failed to read from \"%1$s\": %2$s" ),
+                          zzip_name.generic_u8string() + ":" + ( binary ? binary_file_name : file_name ),
+                          err.what() );
+                return false;
+            }
+            return true;
+        } else if( file_exist( binary_quad_path ) )
+        {
+            std::optional<std::string> contents = read_whole_file( binary_quad_path );
+            if( !contents ) {
+                return false;
+            }
+            try {
+                add_submaps( decode_quad( *contents ) );
             } catch( std::exception &err ) {
-                debugmsg( _( "Failed to read from \"%1$s\": %2$s" ), zzip_name.generic_u8string() + ":" + file_name,
+                debugmsg( _( "Failed to read from \"%1$s\": %2$s" ), binary_quad_path.generic_u8string(),
                           err.what() );
                 return false;
             }
@@ -398,7 +675,7 @@ submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
         } else
         {
             return read_from_file_optional_json( quad_path, [this]( const JsonValue & jsin ) {
-                deserialize( jsin );
+                add_submaps( decode_json_quad( jsin ) );
             } );
         }
     }();
@@ -419,29 +696,11 @@ submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
     return submaps[ p ].get();
 }
 
-void mapbuffer::deserialize( const JsonArray &ja )
+void mapbuffer::add_submaps( quad_submaps &&quad )
 {
-    for( JsonObject submap_json : ja ) {
-        std::unique_ptr<submap> sm = std::make_unique<submap>();
-        tripoint_abs_sm submap_coordinates;
-        int version = 0;
-        // We have to read version first because the iteration order of json members is undefined.
-        if( submap_json.has_int( "version" ) ) {
-            version = submap_json.get_int( "version" );
-        }
-        for( JsonMember submap_member : submap_json ) {
-            std::string submap_member_name = submap_member.name();
-            if( submap_member_name == "coordinates" ) {
-                JsonArray coords_array = submap_member;
-                tripoint_abs_sm loc{ coords_array.next_int(), coords_array.next_int(), coords_array.next_int() };
-                submap_coordinates = loc;
-            } else {
-                sm->load( submap_member, submap_member_name, version );
-            }
-        }
-
-        if( !add_submap( submap_coordinates, sm ) ) {
-            debugmsg( "submap %s was already loaded", submap_coordinates.to_string() );
+    for( std::pair<tripoint_abs_sm, std::unique_ptr<submap>> &entry : quad ) {
+        if( !add_submap( entry.first, entry.second ) ) {
+            debugmsg( "submap %s was already loaded", entry.first.to_string() );
         }
     }
 }
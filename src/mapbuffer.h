@@ -5,10 +5,13 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "coordinates.h"
 
-class JsonArray;
 class cata_path;
 class submap;
 
@@ -66,6 +69,19 @@ class mapbuffer
 
         // Cheaper version of the above for when you don't mind some false results
         bool submap_exists_approx( const tripoint_abs_sm &p );
+        // Whether the submap is in memory; unlike the above this never reads from disk.
+        bool submap_loaded( const tripoint_abs_sm &p ) const;
+
+        /** The submaps stored in one quad file, with their positions. */
+        using quad_submaps = std::vector<std::pair<tripoint_abs_sm, std::unique_ptr<submap>>>;
+        /** Encodes the submaps of one quad in the binary quad file format. */
+        static std::string encode_binary_quad(
+            const std::vector<std::pair<tripoint_abs_sm, const submap *>> &quad );
+        /**
+         * Decodes a quad file in either the binary or the json format.
+         * @throws std::exception if the data is truncated or corrupt.
+         */
+        static quad_submaps decode_quad( std::string_view data );
 
     private:
         using submap_map_t = std::map<tripoint_abs_sm, std::unique_ptr<submap>>;
@@ -84,7 +100,7 @@ class mapbuffer
         void remove_submap( const tripoint_abs_sm &addr );
         submap *unserialize_submaps( const tripoint_abs_sm &p );
         bool submap_file_exists( const tripoint_abs_sm &p );
-        void deserialize( const JsonArray &ja );
+        void add_submaps( quad_submaps &&quad );
         void save_quad(
             const cata_path &dirname, const cata_path &filename,
             const tripoint_abs_omt &om_addr, std::list<tripoint_abs_sm> &submaps_to_delete,
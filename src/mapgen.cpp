@@ -1957,6 +1957,10 @@ class mapgen_value
             virtual const std::string *get_name_if_parameter() const {
                 return nullptr;
             }
+            // @returns true if get() always returns the same value, regardless of mapgendata
+            virtual bool is_constant() const {
+                return false;
+            }
         };
 
         struct null_source : value_source {
@@ -1964,6 +1968,10 @@ class mapgen_value
                 return make_null_helper<Id> {}();
             }
 
+            bool is_constant() const override {
+                return true;
+            }
+
             void check_consistent_with(
                 const value_source &o, const std::string &context ) const override {
                 if( const null_source *other = dynamic_cast<const null_source *>( &o ) ) {
@@ -1993,6 +2001,10 @@ class mapgen_value
                 return id;
             }
 
+            bool is_constant() const override {
+                return true;
+            }
+
             void check( const std::string &context, const mapgen_parameters & ) const override {
                 if( !is_valid_helper( id ) ) {
                     debugmsg( "mapgen '%s' uses invalid entry '%s'",
@@ -2265,6 +2277,10 @@ class mapgen_value
             return is_null_;
         }
 
+        bool is_constant() const {
+            return source_->is_constant();
+        }
+
         void check( const std::string &context, const mapgen_parameters &params ) const {
             source_->check( context, params );
         }
@@ -3606,6 +3622,27 @@ class jmapgen_furniture : public jmapgen_piece_with_has_vehicle_collision
             }
         }
 
+        void apply_run( const mapgendata &dat, int x_begin, int x_end, const jmapgen_int &y,
+                        const jmapgen_int &z, const std::string &context ) const override {
+            if( !id.is_constant() || repeat.val != repeat.valmax ) {
+                jmapgen_piece::apply_run( dat, x_begin, x_end, y, z, context );
+                return;
+            }
+            const furn_id chosen_id = id.get( dat );
+            if( chosen_id.id().is_null() ) {
+                return;
+            }
+            const int repeat_count = std::max( 1, static_cast<int>( repeat.val ) );
+            for( int x = x_begin; x <= x_end; x++ ) {
+                const tripoint_bub_ms p( x, y.get(), dat.zlevel() + z.get() );
+                for( int i = 0; i < repeat_count; i++ ) {
+                    if( !dat.m.furn_set( p, chosen_id ) ) {
+                        debugmsg( "Problem setting furniture in %s", context );
+                    }
+                }
+            }
+        }
+
         void check( const std::string &oter_name, const mapgen_parameters &parameters,
                     const jmapgen_int &/*x*/, const jmapgen_int &/*y*/, const jmapgen_int &/*z*/
                   ) const override {
@@ -3622,6 +3659,12 @@ class jmapgen_terrain : public jmapgen_piece_with_has_vehicle_collision
         enum apply_action {
             act_unknown, act_ignore, act_dismantle, act_erase
         };
+        // What to do with preexisting data, as requested by the flags of the mapgen
+        struct apply_actions {
+            apply_action furn = apply_action::act_unknown;
+            apply_action trap = apply_action::act_unknown;
+            apply_action item = apply_action::act_unknown;
+        };
     public:
         mapgen_value<ter_str_id> id;
         jmapgen_terrain( const JsonObject &jsi, std::string_view/*context*/ ) :
@@ -3641,14 +3684,39 @@ class jmapgen_terrain : public jmapgen_piece_with_has_vehicle_collision
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            tripoint_bub_ms p( x.get(), y.get(), dat.zlevel() + z.get() );
+            const tripoint_bub_ms p( x.get(), y.get(), dat.zlevel() + z.get() );
+            place( dat, p, chosen_id, resolve_actions( dat, context ), context );
+        }
 
-            const ter_id &terrain_here = dat.m.ter( p );
-            const ter_t &chosen_ter = *chosen_id;
-            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
-            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
-            const bool is_boring_wall = is_wall && !place_item;
+        void apply_run( const mapgendata &dat, int x_begin, int x_end, const jmapgen_int &y,
+                        const jmapgen_int &z, const std::string &context ) const override {
+            if( !id.is_constant() || repeat.val != repeat.valmax ) {
+                jmapgen_piece::apply_run( dat, x_begin, x_end, y, z, context );
+                return;
+            }
+            // The terrain and the flags are the same for the whole run, resolve them once
+            const ter_id chosen_id = id.get( dat ).id();
+            if( chosen_id.id().is_null() ) {
+                return;
+            }
+            const apply_actions act = resolve_actions( dat, context );
+            const int repeat_count = std::max( 1, static_cast<int>( repeat.val ) );
+            for( int x = x_begin; x <= x_end; x++ ) {
+                const tripoint_bub_ms p( x, y.get(), dat.zlevel() + z.get() );
+                for( int i = 0; i < repeat_count; i++ ) {
+                    place( dat, p, chosen_id, act, context );
+                }
+            }
+        }
 
+        void check( const std::string &oter_name, const mapgen_parameters &parameters,
+                    const jmapgen_int &/*x*/, const jmapgen_int &/*y*/, const jmapgen_int &/*z*/
+                  ) const override {
+            id.check( oter_name, parameters );
+        }
+
+    private:
+        apply_actions resolve_actions( const mapgendata &dat, const std::string &context ) const {
             apply_action act_furn = apply_action::act_unknown;
             apply_action act_trap = apply_action::act_unknown;
             apply_action act_item = apply_action::act_unknown;
@@ -3696,6 +3764,20 @@ class jmapgen_terrain : public jmapgen_piece_with_has_vehicle_collision
                           "mistake, as any dismantle outputs will not be preserved.",
                           context, dat.terrain_type().id().str() );
             }
+            return { act_furn, act_trap, act_item };
+        }
+
+        void place( const mapgendata &dat, const tripoint_bub_ms &p, const ter_id &chosen_id,
+                    const apply_actions &act, const std::string &context ) const {
+            const apply_action act_furn = act.furn;
+            const apply_action act_trap = act.trap;
+            const apply_action act_item = act.item;
+
+            const ter_id &terrain_here = dat.m.ter( p );
+            const ter_t &chosen_ter = *chosen_id;
+            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
+            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
+            const bool is_boring_wall = is_wall && !place_item;
 
             if( is_boring_wall || act_furn == apply_action::act_erase ) {
                 dat.m.furn_clear( p );
@@ -3777,12 +3859,6 @@ class jmapgen_terrain : public jmapgen_piece_with_has_vehicle_collision
             dat.m.delete_graffiti( p );
             dat.m.ter_set( p, chosen_id );
         }
-
-        void check( const std::string &oter_name, const mapgen_parameters &parameters,
-                    const jmapgen_int &/*x*/, const jmapgen_int &/*y*/, const jmapgen_int &/*z*/
-                  ) const override {
-            id.check( oter_name, parameters );
-        }
 };
 /**
  * Run a transformation.
@@ -5562,6 +5638,35 @@ void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(), compare_phases );
     objects.shrink_to_fit();
+
+    const auto is_fixed_tile = []( const jmapgen_place & where ) {
+        return where.x.val == where.x.valmax && where.y.val == where.y.valmax &&
+               where.z.val == where.z.valmax && where.repeat.val == 1 && where.repeat.valmax == 1;
+    };
+    run_lengths.assign( objects.size(), 1 );
+    // Walk backwards so each run length can extend the one of the next object
+    for( size_t i = objects.size(); i-- > 1; ) {
+        const jmapgen_obj &prev = objects[i - 1];
+        const jmapgen_obj &next = objects[i];
+        if( prev.second == next.second && is_fixed_tile( prev.first ) && is_fixed_tile( next.first ) &&
+            prev.first.y.val == next.first.y.val && prev.first.z.val == next.first.z.val &&
+            prev.first.x.val + 1 == next.first.x.val ) {
+            run_lengths[i - 1] = run_lengths[i] + 1;
+        }
+    }
+}
+
+void jmapgen_piece::apply_run( const mapgendata &dat, int x_begin, int x_end,
+                               const jmapgen_int &y, const jmapgen_int &z,
+                               const std::string &context ) const
+{
+    for( int x = x_begin; x <= x_end; x++ ) {
+        // Same as the repeat handling in jmapgen_objects::apply, the run's places don't repeat
+        const int repeat_count = std::max( 1, repeat.get() );
+        for( int i = 0; i < repeat_count; i++ ) {
+            apply( dat, jmapgen_int( x ), y, z, context );
+        }
+    }
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -6163,9 +6268,11 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
     bool terrain_resolved = false;
 
     auto range_at_phase = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
+    const size_t range_end = range_at_phase.second - objects.begin();
+    const bool has_runs = run_lengths.size() == objects.size();
 
-    for( auto it = range_at_phase.first; it != range_at_phase.second; ++it ) {
-        const jmapgen_obj &obj = *it;
+    for( size_t idx = range_at_phase.first - objects.begin(); idx < range_end; ++idx ) {
+        const jmapgen_obj &obj = objects[idx];
         jmapgen_place where = obj.first;
         where.offset( tripoint_rel_ms( -offset.raw() ) );
         const jmapgen_piece &what = *obj.second;
@@ -6181,6 +6288,14 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
             terrain_resolved = true;
         }
 
+        // Runs never cross phases, as all their objects share the same piece
+        const int run_length = has_runs ? run_lengths[idx] : 1;
+        if( run_length > 1 ) {
+            what.apply_run( dat, where.x.val, where.x.val + run_length - 1, where.y, where.z, context );
+            idx += run_length - 1;
+            continue;
+        }
+
         // The user will only specify repeat once in JSON, but it may get loaded both
         // into the what and where in some cases--we just need the greater value of the two.
         const int repeat = std::max( where.repeat.get(), what.repeat.get() );
@@ -213,6 +213,13 @@ class jmapgen_piece
         virtual void apply( const mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y,
                             const jmapgen_int &z,
                             const std::string &context ) const = 0;
+        /**
+         * Place something at each of x_begin..x_end (inclusive) on row y, same as calling
+         * @ref apply for each of them. Pieces that can resolve what to place once for the
+         * whole run override this.
+         */
+        virtual void apply_run( const mapgendata &dat, int x_begin, int x_end, const jmapgen_int &y,
+                                const jmapgen_int &z, const std::string &context ) const;
         virtual ~jmapgen_piece() = default;
         jmapgen_int repeat;
         virtual ret_val<void> has_vehicle_collision( const mapgendata &,
@@ -421,6 +428,12 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+        /**
+         * Built by @ref finalize: for each object, how many objects starting at it place the same
+         * piece on consecutive tiles of one row (as the "rows" of a mapgen do), 1 otherwise.
+         * @ref apply hands such runs to @ref jmapgen_piece::apply_run in one go.
+         */
+        std::vector<int> run_lengths;
         tripoint_rel_ms m_offset;
         point_rel_ms mapgensize;
         point_rel_ms total_size;
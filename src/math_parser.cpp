@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <locale>
 #include <map>
 #include <memory>
@@ -284,7 +286,7 @@ double var::eval( const_dialogue const &d ) const
             return ret->dbl( d );
         } catch( math::exception &ex ) {
             throw math::runtime_error(
-                R"(Type mismatch in variable "%s" with value "%s": %s)", varinfo.name,
+                R"(Type mismatch in variable "%s" with value "%s": %s)", varinfo.name.str(),
                 ret->to_string(), ex.what() );
         }
     }
@@ -455,11 +457,197 @@ void func_diag::assign( dialogue &d, double val ) const
     throw math::internal_error( "math called assign() on unexpected function that cannot assign" );
 }
 
+bool math_program::compile( thingie const &tree )
+{
+    clear();
+    if( std::holds_alternative<ass_oper>( tree.data ) ) {
+        return false;
+    }
+    compile_node( tree );
+    return true;
+}
+
+void math_program::clear()
+{
+    code.clear();
+    vars.clear();
+    nodes.clear();
+    max_depth = 0;
+    depth = 0;
+}
+
+void math_program::emit( instruction const &ins, int stack_change )
+{
+    code.emplace_back( ins );
+    depth += stack_change;
+    max_depth = std::max( max_depth, depth );
+}
+
+bool math_program::constants_since( std::size_t start, std::size_t count ) const
+{
+    return code.size() - start == count &&
+           std::all_of( code.begin() + start, code.end(), []( instruction const & ins ) {
+        return ins.op == opcode::constant;
+    } );
+}
+
+void math_program::fold( std::size_t start, int count, double value )
+{
+    code.resize( start );
+    depth -= count;
+    instruction ins;
+    ins.value = value;
+    emit( ins, 1 );
+}
+
+void math_program::compile_node( thingie const &thing )
+{
+    std::size_t const start = code.size();
+    std::visit( overloaded{
+        [this]( double v )
+        {
+            instruction ins;
+            ins.value = v;
+            emit( ins, 1 );
+        },
+        [this]( var const & v )
+        {
+            auto const it = std::find_if( vars.begin(), vars.end(), [&v]( var const & slot ) {
+                return slot.varinfo.type == v.varinfo.type && slot.varinfo.name == v.varinfo.name;
+            } );
+            instruction ins;
+            ins.op = opcode::load_var;
+            ins.arg = static_cast<std::uint32_t>( std::distance( vars.begin(), it ) );
+            if( it == vars.end() ) {
+                vars.emplace_back( v );
+            }
+            emit( ins, 1 );
+        },
+        [this, start]( oper const & v )
+        {
+            compile_node( *v.l );
+            compile_node( *v.r );
+            if( constants_since( start, 2 ) ) {
+                fold( start, 2, v.op( code[start].value, code[start + 1].value ) );
+                return;
+            }
+            instruction ins;
+            ins.op = opcode::binary;
+            ins.bin = v.op;
+            emit( ins, -1 );
+        },
+        [this, start]( func const & v )
+        {
+            for( thingie const &param : v.params ) {
+                compile_node( param );
+            }
+            int const argc = static_cast<int>( v.params.size() );
+            auto const f = std::find_if( functions.begin(), functions.end(),
+            [&v]( math_func const & mf ) {
+                return mf.f == v.f;
+            } );
+            if( f != functions.end() && f->foldable && constants_since( start, v.params.size() ) ) {
+                args.clear();
+                for( std::size_t i = start; i < code.size(); i++ ) {
+                    args.emplace_back( code[i].value );
+                }
+                fold( start, argc, v.f( args ) );
+                return;
+            }
+            instruction ins;
+            ins.op = opcode::call;
+            ins.arg = static_cast<std::uint32_t>( argc );
+            ins.fn = v.f;
+            emit( ins, 1 - argc );
+        },
+        [this, start]( ternary const & v )
+        {
+            compile_node( *v.cond );
+            if( constants_since( start, 1 ) ) {
+                double const cond = code[start].value;
+                code.resize( start );
+                depth--;
+                compile_node( cond > 0 ? *v.mhs : *v.rhs );
+                return;
+            }
+            instruction branch;
+            branch.op = opcode::jump_if_false;
+            emit( branch, -1 );
+            std::size_t const branch_pos = code.size() - 1;
+            compile_node( *v.mhs );
+            instruction skip;
+            skip.op = opcode::jump;
+            emit( skip, 0 );
+            std::size_t const skip_pos = code.size() - 1;
+            // both branches leave one value on the stack
+            depth--;
+            code[branch_pos].arg = static_cast<std::uint32_t>( code.size() );
+            compile_node( *v.rhs );
+            code[skip_pos].arg = static_cast<std::uint32_t>( code.size() );
+        },
+        [this, &thing]( auto const & /* v */ )
+        {
+            instruction ins;
+            ins.op = opcode::eval_node;
+            ins.arg = static_cast<std::uint32_t>( nodes.size() );
+            nodes.emplace_back( thing );
+            emit( ins, 1 );
+        },
+    },
+    thing.data );
+}
+
+double math_program::eval( const_dialogue const &d ) const
+{
+    std::array<double, 16> local_stack;
+    std::vector<double> big_stack;
+    double *stack = local_stack.data();
+    if( static_cast<std::size_t>( max_depth ) > local_stack.size() ) {
+        big_stack.resize( max_depth );
+        stack = big_stack.data();
+    }
+    std::size_t sp = 0;
+    for( std::size_t pc = 0; pc < code.size(); ) {
+        instruction const &ins = code[pc++];
+        switch( ins.op ) {
+            case opcode::constant:
+                stack[sp++] = ins.value;
+                break;
+            case opcode::load_var:
+                stack[sp++] = vars[ins.arg].eval( d );
+                break;
+            case opcode::binary:
+                sp--;
+                stack[sp - 1] = ins.bin( stack[sp - 1], stack[sp] );
+                break;
+            case opcode::call:
+                args.assign( stack + sp - ins.arg, stack + sp );
+                sp -= ins.arg;
+                stack[sp++] = ins.fn( args );
+                break;
+            case opcode::eval_node:
+                stack[sp++] = nodes[ins.arg].eval( d );
+                break;
+            case opcode::jump_if_false:
+                if( !( stack[--sp] > 0 ) ) {
+                    pc = ins.arg;
+                }
+                break;
+            case opcode::jump:
+                pc = ins.arg;
+                break;
+        }
+    }
+    return stack[0];
+}
+
 class math_exp::math_exp_impl
 {
     public:
         math_exp_impl() = default;
-        explicit math_exp_impl( thingie &&t ): tree( t ) {}
+        explicit math_exp_impl( thingie &&t ): tree( t ) {
+            program.compile( tree );
+        }
 
         bool parse( std::string_view str, bool handle_errors ) {
             if( str.empty() ) {
@@ -467,6 +655,7 @@ class math_exp::math_exp_impl
             }
             try {
                 _parse( str );
+                program.compile( tree );
             } catch( math::syntax_error const &ex ) {
                 if( handle_errors ) {
                     debugmsg( error( str, ex.what() ) );
@@ -474,6 +663,7 @@ class math_exp::math_exp_impl
                     output = {};
                     arity = {};
                     tree = thingie { 0.0 };
+                    program.clear();
                     return false;
                 }
 
@@ -482,10 +672,10 @@ class math_exp::math_exp_impl
             return true;
         }
         double eval( const_dialogue const &d ) const {
-            return tree.eval( d );
+            return program.empty() ? tree.eval( d ) : program.eval( d );
         }
         double eval( dialogue &d ) const {
-            return tree.eval( d );
+            return program.empty() ? tree.eval( d ) : program.eval( d );
         }
 
         math_type_t get_type() const {
@@ -523,6 +713,8 @@ class math_exp::math_exp_impl
         };
         std::stack<arity_t> arity;
         thingie tree{ 0.0 };
+        // what eval() runs; empty if the tree has to be evaluated directly
+        math_program program;
         std::string_view parse_position;
         parse_state state;
         math_type_t type = math_type_t::ret;
@@ -926,7 +1118,7 @@ void math_exp::math_exp_impl::new_oper()
                     throw math::syntax_error( "rhs of dot operator must be an identifier" );
                 }
                 var_info const &v = std::get<var>( rhs.data ).varinfo;
-                std::string_view n = v.name;
+                std::string_view n = v.name.str();
 
                 output.emplace( std::in_place_type_t<dot_oper>(), l, n );
 
@@ -1028,7 +1220,7 @@ std::string math_exp::math_exp_impl::error( std::string_view str, std::string_vi
         std::holds_alternative<var>( output.top().data ) ) {
         // NOLINTNEXTLINE(cata-translate-string-literal): debug message
         mess = string_format( "%s (or unknown function %s)", mess,
-                              std::get<var>( output.top().data ).varinfo.name );
+                              std::get<var>( output.top().data ).varinfo.name.str() );
     }
 
     offset = std::max<std::ptrdiff_t>( 0, offset - 1 );
@@ -19,6 +19,8 @@ struct math_func {
     int num_params;
     using f_t = double ( * )( std::vector<double> const & );
     f_t f;
+    // false for functions that must run every time, like rng()
+    bool foldable = true;
 };
 using pmath_func = math_func const *;
 
@@ -147,8 +149,8 @@ constexpr std::array<math_func, 20> functions{
     math_func{ "trunc", 1, trunc },
     math_func{ "ceil", 1, ceil },
     math_func{ "round", 1, round },
-    math_func{ "rng", 2, math_rng },
-    math_func{ "rand", 1, rand },
+    math_func{ "rng", 2, math_rng, false },
+    math_func{ "rand", 1, rand, false },
     math_func{ "sqrt", 1, sqrt },
     math_func{ "log", 1, log },
     math_func{ "sin", 1, sin },
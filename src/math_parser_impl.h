@@ -4,6 +4,8 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -230,6 +232,52 @@ constexpr double thingie::eval( dialogue &d ) const
     return eval( static_cast<const_dialogue const &>( d ) );
 }
 
+// Flat stack bytecode compiled from an expression tree. Constant sub-expressions are folded,
+// variable reads go straight to a table of variables and operators and math functions are
+// called directly. Anything else (dialogue functions, jmath, dot operators) is kept as a
+// tree node and evaluated from an eval_node instruction.
+class math_program
+{
+    public:
+        // Returns false and leaves the program empty if the tree has to be evaluated as a
+        // tree (assignments)
+        bool compile( thingie const &tree );
+        void clear();
+        bool empty() const {
+            return code.empty();
+        }
+        double eval( const_dialogue const &d ) const;
+
+    private:
+        enum class opcode : std::uint8_t {
+            constant = 0,   // push value
+            load_var,       // push vars[arg]
+            binary,         // pop r, pop l, push bin( l, r )
+            call,           // pop arg values, push fn( values )
+            eval_node,      // push nodes[arg].eval()
+            jump_if_false,  // pop, jump to arg unless > 0
+            jump,           // jump to arg
+        };
+        struct instruction {
+            opcode op = opcode::constant;
+            std::uint32_t arg = 0;
+            double value = 0;
+            binary_op::f_t bin = nullptr;
+            math_func::f_t fn = nullptr;
+        };
+        std::vector<instruction> code;
+        std::vector<var> vars;
+        std::vector<thingie> nodes;
+        int max_depth = 0;
+        int depth = 0;
+        mutable std::vector<double> args;
+
+        void compile_node( thingie const &thing );
+        void emit( instruction const &ins, int stack_change );
+        bool constants_since( std::size_t start, std::size_t count ) const;
+        void fold( std::size_t start, int count, double value );
+};
+
 using op_t =
     std::variant<pbin_op, punary_op, pass_op, pmath_func, jmath_func_id, scoped_diag_proto, paren>;
 
@@ -100,6 +100,8 @@ static const ter_str_id ter_t_pit( "t_pit" );
 static const ter_str_id ter_t_pit_glass( "t_pit_glass" );
 static const ter_str_id ter_t_pit_spiked( "t_pit_spiked" );
 
+static const option_ref<bool> option_LOG_MONSTER_MOVEMENT( "LOG_MONSTER_MOVEMENT" );
+
 bool monster::is_immune_field( const field_type_id &fid ) const
 {
     if( fid == fd_fungal_haze ) {
@@ -2003,7 +2005,7 @@ bool monster::move_to( const tripoint_bub_ms &p, bool force, bool step_on_critte
             has_flag( mon_flag_AQUATIC ) || ( can_submerge() && !here.veh_at( destination ) )
         ) && here.is_divable( destination );
 
-    if( get_option<bool>( "LOG_MONSTER_MOVEMENT" ) ) {
+    if( option_LOG_MONSTER_MOVEMENT.get() ) {
         //Birds and other flying creatures flying over the deep water terrain
         if( was_water && flies() ) {
             if( one_in( 4 ) ) {
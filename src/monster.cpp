@@ -216,6 +216,12 @@ static const trait_id trait_PHEROMONE_MAMMAL( "PHEROMONE_MAMMAL" );
 static const trait_id trait_TERRIFYING( "TERRIFYING" );
 static const trait_id trait_THRESH_MYCUS( "THRESH_MYCUS" );
 
+static const option_ref<float>
+option_EVOLUTION_INVERSE_MULTIPLIER( "EVOLUTION_INVERSE_MULTIPLIER" );
+static const option_ref<bool> option_LOG_MONSTER_ATTACK_MONSTER( "LOG_MONSTER_ATTACK_MONSTER" );
+static const option_ref<bool> option_LOG_MONSTER_MOVE_EFFECTS( "LOG_MONSTER_MOVE_EFFECTS" );
+static const option_ref<bool> option_PORTAL_STORM_IGNORE_NPC( "PORTAL_STORM_IGNORE_NPC" );
+
 // Limit the number of iterations for next upgrade_time calculations.
 // This also sets the percentage of monsters that will never upgrade.
 // The rough formula is 2^(-x), e.g. for x = 5 it's 0.03125 (~ 3%).
@@ -376,7 +382,7 @@ void monster::poly( const mtype_id &id )
 
 bool monster::can_upgrade() const
 {
-    return upgrades && get_option<float>( "EVOLUTION_INVERSE_MULTIPLIER" ) > 0.0;
+    return upgrades && option_EVOLUTION_INVERSE_MULTIPLIER.get() > 0.0;
 }
 
 void monster::gravity_check()
@@ -399,7 +405,7 @@ void monster::hasten_upgrade()
         return;
     }
 
-    const int scaled_half_life = type->half_life * get_option<float>( "EVOLUTION_INVERSE_MULTIPLIER" );
+    const int scaled_half_life = type->half_life * option_EVOLUTION_INVERSE_MULTIPLIER.get();
     upgrade_time -= rng( 1, scaled_half_life );
     if( upgrade_time < 0 ) {
         upgrade_time = 0;
@@ -424,7 +430,7 @@ int monster::next_upgrade_time()
     if( type->age_grow > 0 ) {
         return type->age_grow;
     }
-    const int scaled_half_life = type->half_life * get_option<float>( "EVOLUTION_INVERSE_MULTIPLIER" );
+    const int scaled_half_life = type->half_life * option_EVOLUTION_INVERSE_MULTIPLIER.get();
     int day = 1; // 1 day of guaranteed evolve time
     for( int i = 0; i < UPGRADE_MAX_ITERS; i++ ) {
         if( one_in( 2 ) ) {
@@ -1726,7 +1732,7 @@ monster_attitude monster::attitude( const Character *u ) const
     // override for the Personal Portal Storms Mod
     // if the monster is a nether portal monster and the character is an NPC then ignore
     if( u != nullptr && faction == monfaction_nether_player_hate && u->is_npc() &&
-        get_option<bool>( "PORTAL_STORM_IGNORE_NPC" ) ) {
+        option_PORTAL_STORM_IGNORE_NPC.get() ) {
         // portal storm creatures ignore NPCs no matter what with this mod on
         return MATT_FPASSIVE;
     }
@@ -2266,7 +2272,7 @@ bool monster::melee_attack( Creature &target, float accuracy )
                     add_msg( m_good, _( "Your %1$s hits %2$s for %3$d damage!" ), get_name(), target.disp_name(),
                              total_dealt );
                 }
-                if( get_option<bool>( "LOG_MONSTER_ATTACK_MONSTER" ) ) {
+                if( option_LOG_MONSTER_ATTACK_MONSTER.get() ) {
                     if( !u_see_me && u_see_target ) {
                         add_msg( _( "Something hits the %1$s!" ), target.disp_name() );
                     } else if( !u_see_target ) {
@@ -2300,7 +2306,7 @@ bool monster::melee_attack( Creature &target, float accuracy )
                          body_part_name_accusative( dealt_dam.bp_hit ),
                          target.disp_name( true ),
                          target.skin_name() );
-            } else if( get_option<bool>( "LOG_MONSTER_ATTACK_MONSTER" ) ) {
+            } else if( option_LOG_MONSTER_ATTACK_MONSTER.get() ) {
                 //~ $1s is monster name, %2$s is that monster target name,
                 //~ $3s is target armor name.
                 add_msg( _( "%1$s hits %2$s but is stopped by its %3$s." ),
@@ -2503,13 +2509,13 @@ bool monster::move_effects( bool )
         bool immediate_break = type->in_species( species_FISH ) || type->in_species( species_MOLLUSK ) ||
                                type->in_species( species_ROBOT ) || type->bodytype == "snake" || type->bodytype == "blob";
         if( !immediate_break && rng( 0, 900 ) > type->melee_dice * type->melee_sides * 1.5 ) {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                 add_msg( _( "The %s struggles to break free of its bonds." ), name() );
             }
         } else if( immediate_break ) {
             remove_effect( effect_tied );
             if( tied_item ) {
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                     add_msg( _( "The %s easily slips out of its bonds." ), name() );
                 }
                 here.add_item_or_charges( pos_bub(), *tied_item );
@@ -2523,7 +2529,7 @@ bool monster::move_effects( bool )
                     here.add_item_or_charges( pos_bub(), *tied_item );
                 }
                 tied_item.reset();
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                     if( broken ) {
                         add_msg( _( "The %s snaps the bindings holding it down." ), name() );
                     } else {
@@ -2537,11 +2543,11 @@ bool monster::move_effects( bool )
     }
     if( has_effect( effect_downed ) ) {
         if( rng( 0, 40 ) > type->melee_dice * type->melee_sides * 1.5 ) {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                 add_msg( _( "The %s struggles to stand." ), name() );
             }
         } else {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                 add_msg( _( "The %s climbs to its feet!" ), name() );
             }
             remove_effect( effect_downed );
@@ -2550,7 +2556,7 @@ bool monster::move_effects( bool )
     }
     if( has_effect( effect_webbed ) ) {
         if( x_in_y( type->melee_dice * type->melee_sides, 6 * get_effect_int( effect_webbed ) ) ) {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                 add_msg( _( "The %s breaks free of the webs!" ), name() );
             }
             remove_effect( effect_webbed );
@@ -2560,7 +2566,7 @@ bool monster::move_effects( bool )
     if( has_effect( effect_lightsnare ) ) {
         if( x_in_y( type->melee_dice * type->melee_sides, 12 ) ) {
             remove_effect( effect_lightsnare );
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                 add_msg( _( "The %s escapes the light snare!" ), name() );
             }
         }
@@ -2572,7 +2578,7 @@ bool monster::move_effects( bool )
                 remove_effect( effect_heavysnare );
                 here.spawn_item( pos_bub(), itype_rope_6 );
                 here.spawn_item( pos_bub(), itype_snare_trigger );
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                     add_msg( _( "The %s escapes the heavy snare!" ), name() );
                 }
             }
@@ -2584,7 +2590,7 @@ bool monster::move_effects( bool )
             if( x_in_y( type->melee_dice * type->melee_sides, 200 ) ) {
                 remove_effect( effect_beartrap );
                 here.spawn_item( pos_bub(), itype_beartrap );
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                     add_msg( _( "The %s escapes the bear trap!" ), name() );
                 }
             }
@@ -2594,7 +2600,7 @@ bool monster::move_effects( bool )
     if( has_effect( effect_crushed ) ) {
         if( x_in_y( type->melee_dice * type->melee_sides, 100 ) ) {
             remove_effect( effect_crushed );
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                 add_msg( _( "The %s frees itself from the rubble!" ), name() );
             }
         }
@@ -2610,7 +2616,7 @@ bool monster::move_effects( bool )
         if( rng( 0, 40 ) > type->melee_dice * type->melee_sides ) {
             return false;
         } else {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                 add_msg( _( "The %s escapes the pit!" ), name() );
             }
             remove_effect( effect_in_pit );
@@ -2641,7 +2647,7 @@ bool monster::move_effects( bool )
             if( grabber == nullptr ) {
                 remove_effect( grab.get_id() );
                 add_msg_debug( debugmode::DF_MATTACK, "Orphan grab found and removed" );
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                     add_msg( _( "The %s is no longer grabbed!" ), name() );
                 }
                 continue;
@@ -2653,7 +2659,7 @@ bool monster::move_effects( bool )
             if( !x_in_y( monster, grab_str ) ) {
                 return false;
             } else {
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && option_LOG_MONSTER_MOVE_EFFECTS.get() ) {
                     add_msg( _( "The %s breaks free from the %s's grab!" ), name(), grabber->name() );
                 }
                 remove_effect( grab.get_id() );
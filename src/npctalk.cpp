@@ -2656,22 +2656,22 @@ void dialogue::add_topic( const talk_topic &topic )
     }
 }
 
-void const_dialogue::set_value( const std::string &key, diag_value value )
+void const_dialogue::set_value( const var_key &key, diag_value value )
 {
     context[key] = std::move( value );
 }
 
-void const_dialogue::remove_value( const std::string &key )
+void const_dialogue::remove_value( const var_key &key )
 {
     context->erase( key );
 }
 
-diag_value const &const_dialogue::get_value( const std::string &key ) const
+diag_value const &const_dialogue::get_value( const var_key &key ) const
 {
     return global_variables::_common_get_value( key, context );
 }
 
-diag_value const *const_dialogue::maybe_get_value( const std::string &key ) const
+diag_value const *const_dialogue::maybe_get_value( const var_key &key ) const
 {
     return global_variables::_common_maybe_get_value( key, context );
 }
@@ -4984,7 +4984,7 @@ talk_effect_fun_t::func f_guard_pos( const JsonObject &jo, std::string_view memb
         if( guy ) {
             var_info cur_var = target_var;
             if( unique_id ) {
-                cur_var.name.insert( 0, guy->get_unique_id() );
+                cur_var.name = guy->get_unique_id() + cur_var.name.str();
             }
             tripoint_abs_ms target_location = read_var_value( cur_var, d ).tripoint();
             guy->set_guard_pos( target_location );
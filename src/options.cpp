@@ -962,6 +962,7 @@ int options_manager::cOpt::getMaxLength() const
 //set to next item
 void options_manager::cOpt::setNext()
 {
+    mark_values_changed();
     if( sType == "string_select" ) {
         int iNext = getItemPos( sSet ) + 1;
         if( iNext >= static_cast<int>( vItems.size() ) ) {
@@ -1005,6 +1006,7 @@ void options_manager::cOpt::setNext()
 //set to previous item
 void options_manager::cOpt::setPrev()
 {
+    mark_values_changed();
     if( sType == "string_select" ) {
         int iPrev = static_cast<int>( getItemPos( sSet ) ) - 1;
         if( iPrev < 0 ) {
@@ -1047,6 +1049,7 @@ void options_manager::cOpt::setValue( float fSetIn )
         debugmsg( "tried to set a float value to a %s option", sType );
         return;
     }
+    mark_values_changed();
     fSet = fSetIn;
     if( fSet < fMin || fSet > fMax ) {
         fSet = fDefault;
@@ -1060,6 +1063,7 @@ void options_manager::cOpt::setValue( int iSetIn )
         debugmsg( "tried to set an int value to a %s option", sType );
         return;
     }
+    mark_values_changed();
     iSet = iSetIn;
     if( iSet < iMin || iSet > iMax ) {
         iSet = iDefault;
@@ -1069,6 +1073,7 @@ void options_manager::cOpt::setValue( int iSetIn )
 //set value
 void options_manager::cOpt::setValue( const std::string &sSetIn )
 {
+    mark_values_changed();
     if( sType == "string_select" ) {
         if( getItemPos( sSetIn ) != -1 ) {
             sSet = sSetIn;
@@ -2902,6 +2907,13 @@ void options_manager::add_options_debug()
          false
 #endif
        );
+
+    add_empty_line();
+
+    add( "BINARY_SUBMAP_SAVES", "debug", to_translation( "Save map in binary format" ),
+         to_translation( "If true, terrain and furniture are saved in a compact binary format that is faster to save and load than JSON.  Maps saved in either format can always be loaded, and are converted when next saved." ),
+         false
+       );
 }
 
 void options_manager::add_options_android()
@@ -3910,6 +3922,8 @@ std::string options_manager::show( bool ingame, const bool world_options_only, b
             if( ingame && world_options_changed ) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            // Whole containers were swapped back, nothing went through cOpt::setValue
+            mark_values_changed();
         }
     }
 
@@ -4155,6 +4169,7 @@ options_manager::options_container options_manager::get_world_defaults() const
 
 void options_manager::set_world_options( options_container *options )
 {
+    mark_values_changed();
     if( options == nullptr ) {
         world_options.reset();
     } else {
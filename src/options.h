@@ -3,6 +3,7 @@
 #define CATA_SRC_OPTIONS_H
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <optional>
@@ -223,6 +224,17 @@ class options_manager
         // updates the caches in options_cache.h
         static void update_options_cache();
 
+        /**
+         * Changes whenever an option value may have changed, lets @ref option_ref know when
+         * its cached value has gone stale.
+         */
+        static std::uint64_t get_values_version() {
+            return values_version;
+        }
+        static void mark_values_changed() {
+            ++values_version;
+        }
+
         /**
          * Returns a copy of the options in the "world default" page. The options have their
          * current value, which acts as the default for new worlds.
@@ -284,6 +296,8 @@ class options_manager
                   const std::string &format = "%.2f" );
 
     private:
+        // Starts above the version of a never read option_ref
+        inline static std::uint64_t values_version = 1;
         options_container options;
         std::optional<options_container *> world_options; // NOLINT(cata-serialize)
 
@@ -509,4 +523,31 @@ inline T get_option( const std::string &name, bool convert = false )
     return get_options().get_option( name ).value_as<T>( convert );
 }
 
+/**
+ * Handle to an option that is read often, e.g. every turn or for every monster.
+ *
+ * The option is only looked up by name on the first read and after option values have
+ * changed, any other read returns the cached value.  Meant to be declared once as a static
+ * constant next to the code using it, like the id constants.
+ */
+template<typename T>
+class option_ref
+{
+    public:
+        explicit option_ref( const std::string &name ) : name( name ) {}
+
+        const T &get() const {
+            if( version != options_manager::get_values_version() ) {
+                value = get_option<T>( name );
+                version = options_manager::get_values_version();
+            }
+            return value;
+        }
+
+    private:
+        std::string name;
+        mutable T value = T();
+        mutable std::uint64_t version = 0;
+};
+
 #endif // CATA_SRC_OPTIONS_H
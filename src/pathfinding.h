@@ -48,6 +48,7 @@ enum class PathfindingFlag : uint8_t {
     RestrictLarge,  // Large cannot enter
     RestrictHuge,   // Huge cannot enter
     Lava,           // Lava terrain
+    Uneven,         // Terrain + furniture move cost isn't 2 (ignores vehicles and fields)
 };
 
 class PathfindingFlags
@@ -143,16 +143,14 @@ void game::serialize_json( std::ostream &fout )
                  inactive_global_effect_on_condition_vector );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_global_effect_on_conditions );
     json.member( "queued_global_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc *queued : queued_global_effect_on_conditions.sorted() ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued->time );
+        json.member( "eoc", queued->eoc );
+        json.member( "context", queued->context );
         json.end_object();
-        temp_queued.pop();
     }
     json.end_array();
     global_variables_instance.serialize( json );
@@ -1969,7 +1967,7 @@ void faction_manager::deserialize( const JsonValue &jv )
 void creature_tracker::deserialize( const JsonArray &ja )
 {
     monsters_list.clear();
-    monsters_by_location.clear();
+    clear_locations();
     for( JsonValue jv : ja ) {
         // TODO: would be nice if monster had a constructor using JsonIn or similar, so this could be one statement.
         shared_ptr_fast<monster> mptr = make_shared_fast<monster>();
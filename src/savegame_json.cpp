@@ -1554,16 +1554,14 @@ void Character::store( JsonOut &json ) const
     json.member( "suppress_autohaul", suppress_autohaul );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_effect_on_conditions );
     json.member( "queued_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc *queued : queued_effect_on_conditions.sorted() ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued->time );
+        json.member( "eoc", queued->eoc );
+        json.member( "context", queued->context );
         json.end_object();
-        temp_queued.pop();
     }
 
     json.end_array();
@@ -1677,6 +1675,7 @@ void avatar::deserialize( const JsonObject &data )
 void avatar::load( const JsonObject &data )
 {
     Character::load( data );
+    body_updated_to.reset();
 
     std::string prof_ident = "(null)";
     if( data.read( "profession", prof_ident ) && string_id<profession>( prof_ident ).is_valid() ) {
@@ -2923,9 +2922,9 @@ void item::io( Archive &archive )
     if( savegame_loading_version < 36 ) {
         const std::string prefix = "npctalk_var_";
         for( auto i = item_vars.begin(); i != item_vars.end(); ) {
-            if( i->first.rfind( prefix, 0 ) == 0 ) {
+            if( i->first.str().rfind( prefix, 0 ) == 0 ) {
                 global_variables::impl_t::node_type extracted = ( *item_vars ).extract( i++ );
-                std::string new_key = extracted.key().substr( prefix.size() );
+                std::string new_key = extracted.key().str().substr( prefix.size() );
                 extracted.key() = new_key;
                 item_vars.insert( std::move( extracted ) );
             } else {
@@ -3036,6 +3035,7 @@ void item::io( Archive &archive )
     erase_if( item_tags, [&]( const flag_id & f ) {
         return !f.is_valid();
     } );
+    update_tags_bloom();
 
     if( note_read ) {
         snip_id = SNIPPET.migrate_hash_to_id( note );
@@ -3098,7 +3098,7 @@ void item::io( Archive &archive )
     // counter, it will always be 0 and it prevents proper stacking.
     if( get_chapters() == 0 ) {
         for( auto it = item_vars.begin(); it != item_vars.end(); ) {
-            if( it->first.compare( 0, 19, "remaining-chapters-" ) == 0 ) {
+            if( it->first.str().compare( 0, 19, "remaining-chapters-" ) == 0 ) {
                 item_vars.erase( it++ );
             } else {
                 ++it;
@@ -4050,7 +4050,8 @@ void player_morale::load( const JsonObject &jsin )
     jsin.read( "morale", points );
 }
 
-void mm_submap::serialize( JsonOut &jsout ) const
+void mm_submap::serialize( JsonOut &jsout, std::vector<uint32_t> &palette,
+                           std::unordered_map<uint32_t, uint32_t> &palette_index ) const
 {
     jsout.start_array();
 
@@ -4059,15 +4060,23 @@ void mm_submap::serialize( JsonOut &jsout ) const
     memorized_tile last;
     int num_same = 1;
 
+    const auto palette_entry = [&]( uint32_t id ) {
+        const auto it = palette_index.emplace( id, palette.size() );
+        if( it.second ) {
+            palette.push_back( id );
+        }
+        return it.first->second;
+    };
+
     const auto write_seq = [&]() {
         jsout.start_array();
         jsout.write( num_same );
         jsout.write( static_cast<int>( last.symbol ) );
-        jsout.write( last.ter_id );
+        jsout.write( palette_entry( last.ter_id ) );
         jsout.write( static_cast<int>( last.ter_subtile ) );
         jsout.write( static_cast<int>( last.ter_rotation ) );
-        if( !last.get_dec_id().empty() ) {
-            jsout.write( last.dec_id );
+        if( last.dec_id != 0 ) {
+            jsout.write( palette_entry( last.dec_id ) );
             jsout.write( static_cast<int>( last.dec_subtile ) );
             jsout.write( static_cast<int>( last.dec_rotation ) );
         }
@@ -4095,8 +4104,20 @@ void mm_submap::serialize( JsonOut &jsout ) const
     jsout.end_array();
 }
 
-void mm_submap::deserialize( int version, const JsonArray &ja )
+void mm_submap::deserialize( int version, const JsonArray &ja,
+                             const std::vector<uint32_t> &palette )
 {
+    const auto read_id = [&]( const JsonArray & ja_tile, int idx ) -> uint32_t {
+        if( version < 2 ) {
+            return memorized_tile::intern_id( ja_tile.get_string( idx ) );
+        }
+        const int entry = ja_tile.get_int( idx );
+        if( entry < 0 || static_cast<size_t>( entry ) >= palette.size() ) {
+            ja_tile.throw_error( "map memory palette index out of range" );
+        }
+        return palette[entry];
+    };
+
     size_t submap_array_idx = 0;
 
     // Uses RLE for compression.
@@ -4125,7 +4146,7 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                         tile.set_dec_id( std::move( id ) );
                         tile.set_dec_subtile( ja_tile.get_int( 1 ) );
                         const int legacy_rotation = ja_tile.get_int( 2 );
-                        if( string_starts_with( tile.dec_id, "vp_" ) ) {
+                        if( string_starts_with( tile.get_dec_id(), "vp_" ) ) {
                             // legacy vehicle rotation needs to be converted from 0-360 degrees
                             // to 0-3 tileset rotation
                             const units::angle legacy_angle = units::from_degrees( legacy_rotation );
@@ -4141,15 +4162,15 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                 } else {
                     remaining = ja_tile.get_int( 0 ) - 1;
                     tile.symbol = ja_tile.get_int( 1 );
-                    tile.set_ter_id( ja_tile.get_string( 2 ) );
+                    tile.ter_id = read_id( ja_tile, 2 );
                     tile.ter_subtile = ja_tile.get_int( 3 );
                     tile.ter_rotation = ja_tile.get_int( 4 );
                     if( ja_tile.size() > 5 ) {
-                        tile.set_dec_id( ja_tile.get_string( 5 ) );
+                        tile.dec_id = read_id( ja_tile, 5 );
                         tile.dec_subtile = ja_tile.get_int( 6 );
                         tile.dec_rotation = ja_tile.get_int( 7 );
                     } else {
-                        tile.set_dec_id( "" );
+                        tile.dec_id = 0;
                         tile.dec_subtile = 0;
                         tile.dec_rotation = 0;
                     }
@@ -4165,8 +4186,12 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
 
 void mm_region::serialize( JsonOut &jsout ) const
 {
+    // Version 2 stores each distinct id once in "palette", tiles refer to it by index.
+    std::vector<uint32_t> palette;
+    std::unordered_map<uint32_t, uint32_t> palette_index;
+
     jsout.start_object();
-    jsout.member( "version", 1 );
+    jsout.member( "version", 2 );
     jsout.write( "data" );
     jsout.write_member_separator();
     jsout.start_array();
@@ -4177,11 +4202,17 @@ void mm_region::serialize( JsonOut &jsout ) const
             if( sm->is_empty() ) {
                 jsout.write_null();
             } else {
-                sm->serialize( jsout );
+                sm->serialize( jsout, palette, palette_index );
             }
         }
     }
     jsout.end_array();
+    jsout.member( "palette" );
+    jsout.start_array();
+    for( const uint32_t id : palette ) {
+        jsout.write( memorized_tile::interned_id( id ) );
+    }
+    jsout.end_array();
     jsout.end_object();
 }
 
@@ -4189,6 +4220,7 @@ void mm_region::deserialize( const JsonValue &ja )
 {
     int version;
     JsonArray region_json;
+    std::vector<uint32_t> palette;
 
     if( ja.test_array() ) { // legacy, remove after 0.H comes out
         version = 0;
@@ -4197,6 +4229,11 @@ void mm_region::deserialize( const JsonValue &ja )
         JsonObject region_obj = ja;
         version = region_obj.get_int( "version" );
         region_json = region_obj.get_array( "data" );
+        if( version >= 2 ) {
+            for( const std::string id : region_obj.get_array( "palette" ) ) {
+                palette.push_back( memorized_tile::intern_id( id ) );
+            }
+        }
     }
 
     for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
@@ -4206,7 +4243,7 @@ void mm_region::deserialize( const JsonValue &ja )
             sm = make_shared_fast<mm_submap>();
             const JsonValue jsin = region_json.next_value();
             if( !jsin.test_null() ) {
-                sm->deserialize( version, jsin );
+                sm->deserialize( version, jsin, palette );
             }
         }
     }
@@ -4665,6 +4702,7 @@ void event_multiset::serialize( JsonOut &jsout ) const
 void event_multiset::deserialize( const JsonObject &jo )
 {
     jo.allow_omitted_members();
+    payload_index_.summaries.clear();
     JsonArray events = jo.get_array( "event_counts" );
     if( !events.empty() && events.get_array( 0 ).has_int( 1 ) ) {
         // TEMPORARY until 0.F
@@ -4857,26 +4895,18 @@ void field_type_migrations::check()
     }
 }
 
-void submap::store( JsonOut &jsout ) const
+// Terrain is saved using a simple RLE scheme.  Legacy saves don't have
+// this feature but the algorithm is backward compatible.
+static void store_terrain_rle( JsonOut &jsout, const maptile_soa &m )
 {
-    jsout.member( "turn_last_touched", last_touched );
-    jsout.member( "temperature", temperature_mod );
-
-    // Terrain is saved using a simple RLE scheme.  Legacy saves don't have
-    // this feature but the algorithm is backward compatible.
     jsout.member( "terrain" );
     jsout.start_array();
-    if( is_uniform() ) {
-        _write_rle_terrain( jsout, uniform_ter.id().str(), SEEX * SEEY );
-        jsout.end_array();
-        return;
-    }
     std::string last_id;
     int num_same = 1;
     for( int j = 0; j < SEEY; j++ ) {
         // NOLINTNEXTLINE(modernize-loop-convert)
         for( int i = 0; i < SEEX; i++ ) {
-            const std::string this_id = m->ter[i][j].obj().id.str();
+            const std::string this_id = m.ter[i][j].obj().id.str();
             if( !last_id.empty() ) {
                 if( this_id == last_id ) {
                     num_same++;
@@ -4905,6 +4935,26 @@ void submap::store( JsonOut &jsout ) const
         jsout.end_array();
     }
     jsout.end_array();
+}
+
+void submap::store( JsonOut &jsout, bool ter_furn ) const
+{
+    jsout.member( "turn_last_touched", last_touched );
+    jsout.member( "temperature", temperature_mod );
+
+    if( is_uniform() ) {
+        if( ter_furn ) {
+            jsout.member( "terrain" );
+            jsout.start_array();
+            _write_rle_terrain( jsout, uniform_ter.id().str(), SEEX * SEEY );
+            jsout.end_array();
+        }
+        return;
+    }
+
+    if( ter_furn ) {
+        store_terrain_rle( jsout, *m );
+    }
 
     // Write out the radiation array in a simple RLE scheme.
     // written in intensity, count pairs
@@ -4932,22 +4982,24 @@ void submap::store( JsonOut &jsout ) const
     jsout.write( count );
     jsout.end_array();
 
-    jsout.member( "furniture" );
-    jsout.start_array();
-    for( int j = 0; j < SEEY; j++ ) {
-        for( int i = 0; i < SEEX; i++ ) {
-            const point_sm_ms p( i, j );
-            // Save furniture
-            if( get_furn( p ) ) {
-                jsout.start_array();
-                jsout.write( p.x() );
-                jsout.write( p.y() );
-                jsout.write( get_furn( p ).obj().id );
-                jsout.end_array();
+    if( ter_furn ) {
+        jsout.member( "furniture" );
+        jsout.start_array();
+        for( int j = 0; j < SEEY; j++ ) {
+            for( int i = 0; i < SEEX; i++ ) {
+                const point_sm_ms p( i, j );
+                // Save furniture
+                if( get_furn( p ) ) {
+                    jsout.start_array();
+                    jsout.write( p.x() );
+                    jsout.write( p.y() );
+                    jsout.write( get_furn( p ).obj().id );
+                    jsout.end_array();
+                }
             }
         }
+        jsout.end_array();
     }
-    jsout.end_array();
 
     jsout.member( "items" );
     jsout.start_array();
@@ -5383,3 +5435,91 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
         camp->deserialize( jv );
     }
 }
+
+template<typename T>
+static std::uint16_t palette_index( std::vector<int_id<T>> &palette, const int_id<T> &id )
+{
+    auto found = std::find( palette.begin(), palette.end(), id );
+    if( found == palette.end() ) {
+        palette.push_back( id );
+        return static_cast<std::uint16_t>( palette.size() - 1 );
+    }
+    return static_cast<std::uint16_t>( found - palette.begin() );
+}
+
+void submap::store( submap_ter_furn &ter_furn ) const
+{
+    std::vector<ter_id> ters;
+    std::vector<furn_id> furns;
+    for( int j = 0; j < SEEY; j++ ) {
+        for( int i = 0; i < SEEX; i++ ) {
+            const point_sm_ms p( i, j );
+            ter_furn.ter[i][j] = palette_index( ters, get_ter( p ) );
+            ter_furn.furn[i][j] = palette_index( furns, get_furn( p ) );
+        }
+    }
+    ter_furn.ter_palette.clear();
+    for( const ter_id &ter : ters ) {
+        ter_furn.ter_palette.push_back( ter.id() );
+    }
+    ter_furn.furn_palette.clear();
+    for( const furn_id &furn : furns ) {
+        ter_furn.furn_palette.push_back( furn.id() );
+    }
+}
+
+void submap::load( const submap_ter_furn &ter_furn )
+{
+    ensure_nonuniform();
+    // Every id is looked up and migrated once, however many tiles use it.
+    std::vector<ter_id> ters;
+    std::vector<furn_id> ter_furns;
+    for( ter_str_id terstr : ter_furn.ter_palette ) {
+        furn_id furn = furn_str_id::NULL_ID();
+        if( auto it = ter_migrations.find( terstr ); it != ter_migrations.end() ) {
+            terstr = it->second.first;
+            furn = it->second.second.id();
+        }
+        if( !terstr.is_valid() ) {
+            debugmsg( "invalid ter_str_id '%s'", terstr.c_str() );
+            terstr = ter_t_dirt;
+        }
+        ters.push_back( terstr.id() );
+        ter_furns.push_back( furn );
+    }
+    std::vector<furn_id> furns;
+    std::vector<ter_id> furn_ters;
+    for( furn_str_id furnstr : ter_furn.furn_palette ) {
+        ter_id ter = ter_str_id::NULL_ID();
+        if( auto it = furn_migrations.find( furnstr ); it != furn_migrations.end() ) {
+            furnstr = it->second.second;
+            ter = it->second.first.id();
+        }
+        if( !furnstr.is_valid() ) {
+            debugmsg( "invalid furn_str_id '%s'", furnstr.c_str() );
+            furnstr = furn_str_id::NULL_ID();
+        }
+        furns.push_back( furnstr.id() );
+        furn_ters.push_back( ter );
+    }
+
+    for( int j = 0; j < SEEY; j++ ) {
+        for( int i = 0; i < SEEX; i++ ) {
+            const std::uint16_t ter_index = ter_furn.ter[i][j];
+            m->ter[i][j] = ters[ter_index];
+            if( ter_furns[ter_index] ) {
+                m->frn[i][j] = ter_furns[ter_index];
+            }
+            // Like the json furniture member, only tiles that had furniture override the
+            // furniture that came with migrated terrain.
+            const std::uint16_t furn_index = ter_furn.furn[i][j];
+            if( ter_furn.furn_palette[furn_index].is_null() ) {
+                continue;
+            }
+            m->frn[i][j] = furns[furn_index];
+            if( furn_ters[furn_index] ) {
+                m->ter[i][j] = furn_ters[furn_index];
+            }
+        }
+    }
+}
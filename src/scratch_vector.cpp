@@ -0,0 +1,20 @@
+#include "scratch_vector.h"
+
+namespace scratch_vectors
+{
+
+static thread_local int allocation_count = 0;
+
+int take_allocation_count()
+{
+    const int result = allocation_count;
+    allocation_count = 0;
+    return result;
+}
+
+void count_allocation()
+{
+    ++allocation_count;
+}
+
+} // namespace scratch_vectors
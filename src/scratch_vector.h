@@ -0,0 +1,64 @@
+#pragma once
+#ifndef CATA_SRC_SCRATCH_VECTOR_H
+#define CATA_SRC_SCRATCH_VECTOR_H
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace scratch_vectors
+{
+/** Returns how often scratch vectors of the calling thread had to allocate since the last call. */
+int take_allocation_count();
+void count_allocation();
+} // namespace scratch_vectors
+
+/**
+ * Vector for temporaries that would otherwise be allocated and freed again every turn.
+ *
+ * The vector is borrowed from a pool kept per thread and element type.  It goes back into the
+ * pool when the scratch_vector is destroyed, emptied but with its capacity intact, so once the
+ * pooled vectors have grown big enough nothing needs to be allocated anymore.  Scratch vectors
+ * that are alive at the same time get different vectors.
+ */
+template<typename T>
+class scratch_vector
+{
+    public:
+        scratch_vector() : vec( borrow() ), initial_capacity( vec->capacity() ) {}
+        scratch_vector( const scratch_vector & ) = delete;
+        scratch_vector &operator=( const scratch_vector & ) = delete;
+        ~scratch_vector() {
+            if( vec->capacity() != initial_capacity ) {
+                scratch_vectors::count_allocation();
+            }
+            vec->clear();
+            pool().push_back( std::move( vec ) );
+        }
+
+        std::vector<T> &get() {
+            return *vec;
+        }
+
+    private:
+        static std::vector<std::unique_ptr<std::vector<T>>> &pool() {
+            thread_local std::vector<std::unique_ptr<std::vector<T>>> vectors;
+            return vectors;
+        }
+        static std::unique_ptr<std::vector<T>> borrow() {
+            std::vector<std::unique_ptr<std::vector<T>>> &vectors = pool();
+            if( vectors.empty() ) {
+                scratch_vectors::count_allocation();
+                return std::make_unique<std::vector<T>>();
+            }
+            std::unique_ptr<std::vector<T>> result = std::move( vectors.back() );
+            vectors.pop_back();
+            return result;
+        }
+
+        std::unique_ptr<std::vector<T>> vec;
+        std::size_t initial_capacity;
+};
+
+#endif // CATA_SRC_SCRATCH_VECTOR_H
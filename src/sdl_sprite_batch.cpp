@@ -0,0 +1,147 @@
+#if defined(TILES)
+#include "sdl_sprite_batch.h"
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+#include "debug.h"
+
+#define dbg(x) DebugLog((x),D_SDL) << __FILE__ << ":" << __LINE__ << ": "
+
+void SpriteBatch::set_enabled( const SDL_Renderer_Ptr &renderer, const bool enable )
+{
+    if( !enable ) {
+        flush( renderer );
+    }
+    enabled = enable;
+}
+
+bool SpriteBatch::uses_geometry() const
+{
+#if SDL_VERSION_ATLEAST(2,0,18)
+    return !geometry_failed;
+#else
+    return false;
+#endif
+}
+
+int SpriteBatch::render_copy_ex( const SDL_Renderer_Ptr &renderer, SDL_Texture *const tex,
+                                 const SDL_Rect &srcrect, const SDL_Rect &dstrect, const double angle,
+                                 const SDL_RendererFlip flip )
+{
+    if( !enabled || !uses_geometry() ) {
+        return SDL_RenderCopyEx( renderer.get(), tex, &srcrect, &dstrect, angle, nullptr, flip );
+    }
+    if( tex != texture ) {
+        flush( renderer );
+        texture = tex;
+        texture_w = 0;
+        texture_h = 0;
+        Uint8 r = 0;
+        Uint8 g = 0;
+        Uint8 b = 0;
+        Uint8 a = 0;
+        if( SDL_QueryTexture( tex, nullptr, nullptr, &texture_w, &texture_h ) != 0 ||
+            SDL_GetTextureColorMod( tex, &r, &g, &b ) != 0 ||
+            SDL_GetTextureAlphaMod( tex, &a ) != 0 ) {
+            // Let SDL_RenderCopyEx report whatever is wrong with the texture.
+            texture_modulated = true;
+        } else {
+            texture_modulated = r != 255 || g != 255 || b != 255 || a != 255;
+        }
+    }
+    if( texture_modulated || texture_w <= 0 || texture_h <= 0 ) {
+        return SDL_RenderCopyEx( renderer.get(), tex, &srcrect, &dstrect, angle, nullptr, flip );
+    }
+    sprites.push_back( { srcrect, dstrect, angle, flip } );
+    return 0;
+}
+
+void SpriteBatch::flush( const SDL_Renderer_Ptr &renderer )
+{
+    if( !sprites.empty() ) {
+        if( uses_geometry() ) {
+            flush_geometry( renderer );
+        } else {
+            flush_copy_ex( renderer );
+        }
+        sprites.clear();
+    }
+    // The texture may be destroyed once the caller is done drawing, so don't keep
+    // its size around past a flush.
+    texture = nullptr;
+}
+
+void SpriteBatch::flush_copy_ex( const SDL_Renderer_Ptr &renderer )
+{
+    for( const queued_sprite &s : sprites ) {
+        printErrorIf( SDL_RenderCopyEx( renderer.get(), texture, &s.src, &s.dst, s.angle, nullptr,
+                                        s.flip ) != 0, "SDL_RenderCopyEx() failed" );
+    }
+}
+
+void SpriteBatch::flush_geometry( const SDL_Renderer_Ptr &renderer )
+{
+#if SDL_VERSION_ATLEAST(2,0,18)
+    static constexpr SDL_Color white = { 255, 255, 255, 255 };
+    const float inv_w = 1.0f / texture_w;
+    const float inv_h = 1.0f / texture_h;
+
+    vertices.clear();
+    indices.clear();
+    vertices.reserve( sprites.size() * 4 );
+    indices.reserve( sprites.size() * 6 );
+    for( const queued_sprite &s : sprites ) {
+        float u0 = s.src.x * inv_w;
+        float u1 = ( s.src.x + s.src.w ) * inv_w;
+        float v0 = s.src.y * inv_h;
+        float v1 = ( s.src.y + s.src.h ) * inv_h;
+        if( s.flip & SDL_FLIP_HORIZONTAL ) {
+            std::swap( u0, u1 );
+        }
+        if( s.flip & SDL_FLIP_VERTICAL ) {
+            std::swap( v0, v1 );
+        }
+        // Corners relative to the center of the destination, clockwise from the top left.
+        const float half_w = s.dst.w * 0.5f;
+        const float half_h = s.dst.h * 0.5f;
+        const std::array<SDL_FPoint, 4> corners = {{
+                { -half_w, -half_h }, { half_w, -half_h }, { half_w, half_h }, { -half_w, half_h }
+            }
+        };
+        const std::array<SDL_FPoint, 4> uvs = {{ { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 } }};
+        const float center_x = s.dst.x + half_w;
+        const float center_y = s.dst.y + half_h;
+        // Same convention as SDL_RenderCopyEx: degrees, clockwise on screen.
+        const float rad = static_cast<float>( s.angle * M_PI / 180.0 );
+        const float cos_a = s.angle == 0 ? 1.0f : std::cos( rad );
+        const float sin_a = s.angle == 0 ? 0.0f : std::sin( rad );
+
+        const int base = static_cast<int>( vertices.size() );
+        for( size_t i = 0; i < corners.size(); ++i ) {
+            const SDL_FPoint &c = corners[i];
+            SDL_Vertex v;
+            v.position.x = center_x + c.x * cos_a - c.y * sin_a;
+            v.position.y = center_y + c.x * sin_a + c.y * cos_a;
+            v.color = white;
+            v.tex_coord = uvs[i];
+            vertices.push_back( v );
+        }
+        indices.insert( indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 } );
+    }
+
+    if( SDL_RenderGeometry( renderer.get(), texture, vertices.data(),
+                            static_cast<int>( vertices.size() ), indices.data(),
+                            static_cast<int>( indices.size() ) ) != 0 ) {
+        dbg( D_WARNING ) << "SDL_RenderGeometry failed, drawing sprites one by one from now on: "
+                         << SDL_GetError();
+        geometry_failed = true;
+        flush_copy_ex( renderer );
+    }
+#else
+    flush_copy_ex( renderer );
+#endif
+}
+
+#endif // TILES
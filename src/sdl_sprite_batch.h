@@ -0,0 +1,83 @@
+#pragma once
+#ifndef CATA_SRC_SDL_SPRITE_BATCH_H
+#define CATA_SRC_SDL_SPRITE_BATCH_H
+
+#if defined(TILES)
+#include <vector>
+
+#include "sdl_wrappers.h"
+
+/**
+ * Collects sprites that are drawn from the same texture and submits them to the
+ * renderer in one call.
+ *
+ * While batching is enabled, sprites are queued instead of being drawn. The queue
+ * is flushed as soon as a sprite from a different texture arrives, or when
+ * @ref flush is called. The caller must flush before doing anything else with the
+ * renderer (filling rectangles, changing the clip rect or the render target), so
+ * that the draw order is preserved.
+ *
+ * A flush uses a single `SDL_RenderGeometry` call when SDL is new enough and the
+ * renderer accepts it, and falls back to one `SDL_RenderCopyEx` per sprite
+ * otherwise. While batching is disabled every sprite is drawn right away.
+ */
+class SpriteBatch
+{
+    public:
+        bool is_enabled() const {
+            return enabled;
+        }
+        /// Disabling flushes the sprites that are still queued.
+        void set_enabled( const SDL_Renderer_Ptr &renderer, bool enable );
+
+        /// Same parameters as `SDL_RenderCopyEx`, except that @p angle rotates around the
+        /// center of @p dstrect. Returns the result of the SDL call, or 0 if the sprite
+        /// was queued.
+        int render_copy_ex( const SDL_Renderer_Ptr &renderer, SDL_Texture *texture,
+                            const SDL_Rect &srcrect, const SDL_Rect &dstrect, double angle,
+                            SDL_RendererFlip flip );
+
+        /// Submits all queued sprites. Does nothing if the queue is empty.
+        void flush( const SDL_Renderer_Ptr &renderer );
+
+        /// Number of sprites waiting for the next flush.
+        size_t queued() const {
+            return sprites.size();
+        }
+
+        /// Whether flushes go through `SDL_RenderGeometry`. Becomes false if the
+        /// renderer rejects geometry once.
+        bool uses_geometry() const;
+
+    private:
+        struct queued_sprite {
+            SDL_Rect src;
+            SDL_Rect dst;
+            double angle;
+            SDL_RendererFlip flip;
+        };
+
+        void flush_geometry( const SDL_Renderer_Ptr &renderer );
+        void flush_copy_ex( const SDL_Renderer_Ptr &renderer );
+
+        bool enabled = false;
+        bool geometry_failed = false;
+        // Texture shared by all queued sprites, and its size in pixels.
+        SDL_Texture *texture = nullptr;
+        int texture_w = 0;
+        int texture_h = 0;
+        // Set when the texture is color or alpha modulated. Such textures are drawn
+        // with SDL_RenderCopyEx, because vertex colors and texture modulation do not
+        // combine the same way on every SDL backend.
+        bool texture_modulated = false;
+        std::vector<queued_sprite> sprites;
+#if SDL_VERSION_ATLEAST(2,0,18)
+        // Kept between flushes to avoid reallocating every frame.
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+#endif
+};
+
+#endif // TILES
+
+#endif // CATA_SRC_SDL_SPRITE_BATCH_H
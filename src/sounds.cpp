@@ -477,14 +477,17 @@ void sounds::process_sounds()
             overmap_buffer.signal_hordes( target, sig_power );
         }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        // sound_distance is never below the distance along any single axis, so monsters
+        // further than that can't hear it.
+        get_creature_tracker().for_each_monster_in_radius( here.get_abs( source ), vol * 2 - 1,
+        [&]( monster & critter ) {
             // TODO: Generalize this to Creature::hear_sound
             const int dist = sound_distance( source, critter.pos_bub() );
             if( vol * 2 > dist ) {
                 // Exclude monsters that certainly won't hear the sound
                 critter.hear_sound( source, vol, dist, this_centroid.provocative );
             }
-        }
+        } );
         // Trigger sound-triggered traps and ensure they are still valid
         for( const trap *trapType : trap::get_sound_triggered_traps() ) {
             for( const tripoint_bub_ms &tp : here.trap_locations( trapType->id ) ) {
@@ -185,7 +185,17 @@ std::optional<event_multiset::summaries_type::value_type> event_multiset::last()
 
 void event_multiset::add( const cata::event &e )
 {
-    summaries_[e.data()].add( e );
+    const cata::event::payload_type *payload = e.payload();
+    if( !payload ) {
+        summaries_[e.data()].add( e );
+        return;
+    }
+    auto it = payload_index_.summaries.find( *payload );
+    if( it == payload_index_.summaries.end() ) {
+        event_summary &summary = summaries_[e.data()];
+        it = payload_index_.summaries.emplace( *payload, &summary ).first;
+    }
+    it->second->add( e );
 }
 
 void event_multiset::add( const summaries_type::value_type &e )
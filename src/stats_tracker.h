@@ -100,8 +100,25 @@ class event_multiset
         void serialize( JsonOut & ) const;
         void deserialize( const JsonObject &jo );
     private:
+        // Remembers which summary the events with a given payload were added
+        // to, so that adding a repeated event only needs to hash its payload
+        // rather than build and hash a data_type map.  It points into
+        // summaries_, so it is never copied.
+        struct payload_index {
+            payload_index() = default;
+            payload_index( const payload_index & ) {}
+            payload_index &operator=( const payload_index & ) {
+                summaries.clear();
+                return *this;
+            }
+
+            std::unordered_map<cata::event::payload_type, event_summary *,
+                cata::event_payload_hash> summaries;
+        };
+
         event_type type_; // NOLINT(cata-serialize)
         summaries_type summaries_;
+        payload_index payload_index_; // NOLINT(cata-serialize)
 };
 
 class base_watcher
@@ -71,6 +71,8 @@ struct lexicographic;
  *    for old (or static) string_id, second and subsequent method invocations:
  *      conversion to int_id is extremely fast (just returns int field)
  *     `::obj` call is relatively fast (array read by int index), a bit slower than on int_id
+ *    after generic_factory::finalize, the first invocation on a new static string_id is a
+ *      flat table probe by its interned index instead of the hash map lookup
  */
 
 /**
@@ -159,6 +161,9 @@ class string_identity_static
         template<typename T>
         friend class string_id;
 
+        template<typename T>
+        friend class generic_factory;
+
         template<typename T>
         friend struct std::hash; // NOLINT(cert-dcl58-cpp)
 };
@@ -57,6 +57,17 @@ struct spawn_point {
         mission_id( MIS ), friendly( F ), name( N ), data( SD ) {}
 };
 
+/**
+ * Terrain and furniture of a submap as indices into palettes of the ids used.
+ * Binary map saves store this instead of the json terrain and furniture members.
+ */
+struct submap_ter_furn {
+    std::vector<ter_str_id> ter_palette;
+    std::vector<furn_str_id> furn_palette;
+    cata::mdarray<std::uint16_t, point_sm_ms> ter;
+    cata::mdarray<std::uint16_t, point_sm_ms> furn;
+};
+
 // Suppression due to bug in clang-tidy 12
 // NOLINTNEXTLINE(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
 struct maptile_soa {
@@ -285,8 +296,12 @@ class submap
         void rotate( int turns );
         void mirror( bool horizontally );
 
-        void store( JsonOut &jsout ) const;
+        /** @param ter_furn Whether to write the terrain and furniture members too. */
+        void store( JsonOut &jsout, bool ter_furn = true ) const;
         void load( const JsonValue &jv, const std::string &member_name, int version );
+        void store( submap_ter_furn &ter_furn ) const;
+        /** Palette ids are migrated and checked like the json terrain and furniture members. */
+        void load( const submap_ter_furn &ter_furn );
 
         // If is_uniform is true, this submap is a solid block of terrain
         // Uniform submaps aren't saved/loaded, because regenerating them is faster
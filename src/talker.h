@@ -10,6 +10,7 @@
 #include "type_id.h"
 #include "units.h"
 #include "units_fwd.h"
+#include "var_key.h"
 #include <list>
 
 class computer;
@@ -344,13 +345,13 @@ class const_talker
         virtual bool is_mute() const {
             return false;
         }
-        diag_value const &get_value( const std::string &key ) const {
+        diag_value const &get_value( const var_key &key ) const {
             static diag_value const null_val;
             diag_value const *ret = maybe_get_value( key );
             return ret ? *ret : null_val;
         }
 
-        virtual diag_value const *maybe_get_value( const std::string & ) const {
+        virtual diag_value const *maybe_get_value( const var_key & ) const {
             return nullptr;
         }
 
@@ -800,12 +801,12 @@ class talker: virtual public const_talker
         virtual void remove_effect( const efftype_id &, const std::string & ) {}
         virtual void add_bionic( const bionic_id & ) {}
         virtual void remove_bionic( const bionic_id & ) {}
-        virtual void set_value( const std::string &, diag_value const & ) {}
+        virtual void set_value( const var_key &, diag_value const & ) {}
         template <typename... Args>
-        void set_value( const std::string &key, Args... args ) {
+        void set_value( const var_key &key, Args... args ) {
             set_value( key, diag_value{ std::forward<Args>( args )... } );
         }
-        virtual void remove_value( const std::string & ) {}
+        virtual void remove_value( const var_key & ) {}
         virtual std::list<item> use_charges( const itype_id &, int ) {
             return {};
         }
@@ -36,7 +36,7 @@ class talker_furniture_const: public const_talker_cloner<talker_furniture_const>
         tripoint_abs_ms pos_abs() const override;
         tripoint_abs_omt pos_abs_omt() const override;
 
-        diag_value const *maybe_get_value( const std::string &var_name ) const override;
+        diag_value const *maybe_get_value( const var_key &var_name ) const override;
 
         std::vector<std::string> get_topics( bool radio_contact ) const override;
         bool will_talk_to_u( const Character &you, bool force ) const override;
@@ -60,8 +60,8 @@ class talker_furniture: public talker_furniture_const, public talker_cloner<talk
             return me_comp;
         }
 
-        void set_value( const std::string &var_name, diag_value const &value ) override;
-        void remove_value( const std::string & ) override;
+        void set_value( const var_key &var_name, diag_value const &value ) override;
+        void remove_value( const var_key & ) override;
 
     private:
         computer *me_comp{};
@@ -98,7 +98,7 @@ void talker_monster::mod_pain( int amount )
     me_mon->mod_pain( amount );
 }
 
-diag_value const *talker_monster_const::maybe_get_value( const std::string &var_name ) const
+diag_value const *talker_monster_const::maybe_get_value( const var_key &var_name ) const
 {
     return me_mon_const->maybe_get_value( var_name );
 }
@@ -124,12 +124,12 @@ bool talker_monster_const::bodytype( const bodytype_id &bt ) const
     return me_mon_const->type->bodytype == bt;
 }
 
-void talker_monster::set_value( const std::string &var_name, diag_value const &value )
+void talker_monster::set_value( const var_key &var_name, diag_value const &value )
 {
     me_mon->set_value( var_name, value );
 }
 
-void talker_monster::remove_value( const std::string &var_name )
+void talker_monster::remove_value( const var_key &var_name )
 {
     me_mon->remove_value( var_name );
 }
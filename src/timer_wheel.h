@@ -0,0 +1,234 @@
+#pragma once
+#ifndef CATA_SRC_TIMER_WHEEL_H
+#define CATA_SRC_TIMER_WHEEL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * Hierarchical timer wheel keyed by turn.
+ *
+ * Level 0 has one slot per turn of the current 64 turn block, level 1 one slot per 64 turns
+ * of the current 4096 turn block and so on.  Entries further away than the top level can
+ * hold (about 194 days) wait in an overflow list.  Inserting is O(1).  When the wheel reaches
+ * the start of a higher level slot, that slot's entries are moved one or more levels down, so
+ * each entry is touched at most once per level before it expires.  Stretches of time without
+ * any entries are skipped over instead of being walked turn by turn.
+ */
+template<typename T>
+class timer_wheel
+{
+    public:
+        /** Schedules @p value for turn @p when.  Entries at or before the current turn are
+         * returned by the next call to @ref advance. */
+        void insert( std::int64_t when, T value );
+        /** Moves the wheel to turn @p now and appends every entry due by then to @p out,
+         * earliest first.  Moving backwards in time is supported but has to rebuild the wheel. */
+        void advance( std::int64_t now, std::vector<T> &out );
+
+        bool empty() const {
+            return count == 0;
+        }
+        std::size_t size() const {
+            return count;
+        }
+        void clear();
+
+    private:
+        static constexpr int slot_bits = 6;
+        static constexpr int num_slots = 1 << slot_bits;
+        static constexpr std::uint64_t slot_mask = num_slots - 1;
+        static constexpr int num_levels = 4;
+
+        struct entry {
+            std::uint64_t key;
+            T value;
+        };
+
+        // Maps turns to unsigned keys while keeping their order, so that negative turns work
+        // with the bit arithmetic below.
+        static std::uint64_t to_key( std::int64_t turn ) {
+            return static_cast<std::uint64_t>( turn ) ^ ( std::uint64_t{ 1 } << 63 );
+        }
+        static int slot_of( std::uint64_t key, int level ) {
+            return static_cast<int>( ( key >> ( slot_bits * level ) ) & slot_mask );
+        }
+        // Turns covered by one slot of the given level.
+        static std::uint64_t span_of( int level ) {
+            return std::uint64_t{ 1 } << ( slot_bits * level );
+        }
+
+        void place( entry &&e, std::uint64_t ref );
+        void cascade( std::uint64_t start );
+        std::uint64_t next_busy_turn( std::uint64_t next ) const;
+
+        std::array<std::array<std::vector<entry>, num_slots>, num_levels> slots;
+        std::array<std::uint64_t, num_levels> occupied = {};
+        std::vector<entry> overflow;
+        std::vector<entry> due;
+        // Last turn that has been expired.  Everything still in the wheel is later than this.
+        std::uint64_t current = 0;
+        std::size_t count = 0;
+};
+
+template<typename T>
+inline void timer_wheel<T>::insert( std::int64_t when, T value )
+{
+    place( { to_key( when ), std::move( value ) }, current + 1 );
+    ++count;
+}
+
+template<typename T>
+inline void timer_wheel<T>::place( entry &&e, std::uint64_t ref )
+{
+    if( e.key < ref ) {
+        due.emplace_back( std::move( e ) );
+        return;
+    }
+    // The lowest level whose block around ref also contains the entry.
+    const std::uint64_t diff = e.key ^ ref;
+    for( int level = 0; level < num_levels; ++level ) {
+        if( ( diff >> ( slot_bits * ( level + 1 ) ) ) == 0 ) {
+            const int slot = slot_of( e.key, level );
+            slots[level][slot].emplace_back( std::move( e ) );
+            occupied[level] |= std::uint64_t{ 1 } << slot;
+            return;
+        }
+    }
+    overflow.emplace_back( std::move( e ) );
+}
+
+template<typename T>
+inline void timer_wheel<T>::cascade( std::uint64_t start )
+{
+    if( ( start & ( span_of( num_levels ) - 1 ) ) == 0 && !overflow.empty() ) {
+        std::vector<entry> moving;
+        moving.swap( overflow );
+        for( entry &e : moving ) {
+            place( std::move( e ), start );
+        }
+    }
+    for( int level = num_levels - 1; level > 0; --level ) {
+        if( ( start & ( span_of( level ) - 1 ) ) != 0 ) {
+            continue;
+        }
+        const int slot = slot_of( start, level );
+        if( !( occupied[level] & ( std::uint64_t{ 1 } << slot ) ) ) {
+            continue;
+        }
+        std::vector<entry> moving;
+        moving.swap( slots[level][slot] );
+        occupied[level] &= ~( std::uint64_t{ 1 } << slot );
+        for( entry &e : moving ) {
+            place( std::move( e ), start );
+        }
+    }
+}
+
+template<typename T>
+inline std::uint64_t timer_wheel<T>::next_busy_turn( std::uint64_t next ) const
+{
+    // Slots of a level at or before the one holding next are always empty, so the lowest
+    // occupied slot of the lowest non-empty level is the next place anything can happen.
+    for( int level = 0; level < num_levels; ++level ) {
+        if( occupied[level] == 0 ) {
+            continue;
+        }
+        int slot = 0;
+        while( !( occupied[level] & ( std::uint64_t{ 1 } << slot ) ) ) {
+            ++slot;
+        }
+        const std::uint64_t block = next & ~( span_of( level + 1 ) - 1 );
+        return block + static_cast<std::uint64_t>( slot ) * span_of( level );
+    }
+    if( overflow.empty() ) {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+    const auto earliest = std::min_element( overflow.begin(), overflow.end(),
+    []( const entry & lhs, const entry & rhs ) {
+        return lhs.key < rhs.key;
+    } );
+    return earliest->key & ~( span_of( num_levels ) - 1 );
+}
+
+template<typename T>
+inline void timer_wheel<T>::advance( std::int64_t now, std::vector<T> &out )
+{
+    const std::uint64_t target = to_key( now );
+    if( target < current ) {
+        // Time went backwards, put everything back relative to the new turn.
+        std::vector<entry> all;
+        all.swap( due );
+        all.insert( all.end(), std::make_move_iterator( overflow.begin() ),
+                    std::make_move_iterator( overflow.end() ) );
+        overflow.clear();
+        for( int level = 0; level < num_levels; ++level ) {
+            for( std::vector<entry> &slot : slots[level] ) {
+                all.insert( all.end(), std::make_move_iterator( slot.begin() ),
+                            std::make_move_iterator( slot.end() ) );
+                slot.clear();
+            }
+            occupied[level] = 0;
+        }
+        current = target;
+        for( entry &e : all ) {
+            place( std::move( e ), current + 1 );
+        }
+    }
+
+    for( entry &e : due ) {
+        out.emplace_back( std::move( e.value ) );
+    }
+    count -= due.size();
+    due.clear();
+
+    while( current < target && count > 0 ) {
+        std::uint64_t next = current + 1;
+        if( occupied[0] == 0 ) {
+            const std::uint64_t busy = next_busy_turn( next );
+            if( busy > target ) {
+                break;
+            }
+            next = std::max( next, busy );
+        }
+        if( ( next & slot_mask ) == 0 ) {
+            cascade( next );
+        }
+        const std::uint64_t stop = std::min( target, next | slot_mask );
+        for( int slot = slot_of( next, 0 ); slot <= slot_of( stop, 0 ); ++slot ) {
+            if( !( occupied[0] & ( std::uint64_t{ 1 } << slot ) ) ) {
+                continue;
+            }
+            std::vector<entry> &bucket = slots[0][slot];
+            for( entry &e : bucket ) {
+                out.emplace_back( std::move( e.value ) );
+            }
+            count -= bucket.size();
+            bucket.clear();
+            occupied[0] &= ~( std::uint64_t{ 1 } << slot );
+        }
+        current = stop;
+    }
+    current = std::max( current, target );
+}
+
+template<typename T>
+inline void timer_wheel<T>::clear()
+{
+    for( int level = 0; level < num_levels; ++level ) {
+        for( std::vector<entry> &slot : slots[level] ) {
+            slot.clear();
+        }
+        occupied[level] = 0;
+    }
+    overflow.clear();
+    due.clear();
+    count = 0;
+}
+
+#endif // CATA_SRC_TIMER_WHEEL_H
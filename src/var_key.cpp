@@ -0,0 +1,37 @@
+#include "var_key.h"
+
+#include <deque>
+#include <unordered_map>
+
+namespace
+{
+struct var_key_table {
+    // deque, so references handed out by name_of stay valid while new names are added
+    std::deque<std::string> names{ std::string() };
+    std::unordered_map<std::string, std::uint32_t> ids{ { std::string(), 0 } };
+};
+} // namespace
+
+static var_key_table &get_var_key_table()
+{
+    static var_key_table table;
+    return table;
+}
+
+std::uint32_t var_key::intern( const std::string &name )
+{
+    if( name.empty() ) {
+        return 0;
+    }
+    var_key_table &table = get_var_key_table();
+    const auto pair = table.ids.emplace( name, static_cast<std::uint32_t>( table.names.size() ) );
+    if( pair.second ) {
+        table.names.push_back( name );
+    }
+    return pair.first->second;
+}
+
+const std::string &var_key::name_of( std::uint32_t id )
+{
+    return get_var_key_table().names[id];
+}
@@ -0,0 +1,82 @@
+#pragma once
+#ifndef CATA_SRC_VAR_KEY_H
+#define CATA_SRC_VAR_KEY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+/**
+ * Name of a dialogue/creature variable, interned into a process wide table.
+ *
+ * Comparing and hashing a key only looks at its index, so variable maps keyed by var_key never
+ * hash or compare strings.  Building a key from a string does a single table lookup, so keys
+ * that are used often should be built once (when loading json, or as static constants) and
+ * reused.  Keys convert back to their name for saving and display; the index itself is never
+ * saved, as it depends on the order the names were seen in.
+ */
+class var_key
+{
+    public:
+        var_key() = default;
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key( const std::string &name ) : id( intern( name ) ) {}
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key( std::string_view name ) : id( intern( std::string( name ) ) ) {}
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key( const char *name ) : var_key( std::string_view( name ) ) {}
+
+        const std::string &str() const {
+            return name_of( id );
+        }
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        operator const std::string &() const {
+            return str();
+        }
+        std::uint32_t index() const {
+            return id;
+        }
+        bool empty() const {
+            return id == 0;
+        }
+
+        // For use as a json object key
+        const std::string &to_string_writable() const {
+            return str();
+        }
+        static var_key from_string( const std::string &name ) {
+            return var_key( name );
+        }
+
+        bool operator==( const var_key &rhs ) const {
+            return id == rhs.id;
+        }
+        bool operator!=( const var_key &rhs ) const {
+            return id != rhs.id;
+        }
+        // Orders by name, so sorted listings don't depend on interning order.
+        bool operator<( const var_key &rhs ) const {
+            return id != rhs.id && str() < rhs.str();
+        }
+
+    private:
+        static std::uint32_t intern( const std::string &name );
+        static const std::string &name_of( std::uint32_t id );
+
+        // 0 is always the empty name
+        std::uint32_t id = 0;
+};
+
+namespace std
+{
+template<>
+struct hash<var_key> {
+    std::size_t operator()( const var_key &k ) const noexcept {
+        return k.index();
+    }
+};
+} // namespace std
+
+#endif // CATA_SRC_VAR_KEY_H
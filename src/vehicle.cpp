@@ -1197,22 +1197,22 @@ int vehicle::power_to_energy_bat( const units::power power, const time_duration
 }
 
 // Methods for setting/getting misc key/value pairs.
-void vehicle::set_value( const std::string &key, diag_value value )
+void vehicle::set_value( const var_key &key, diag_value value )
 {
     values[ key ] = std::move( value );
 }
 
-void vehicle::remove_value( const std::string &key )
+void vehicle::remove_value( const var_key &key )
 {
     values.erase( key );
 }
 
-diag_value const &vehicle::get_value( const std::string &key ) const
+diag_value const &vehicle::get_value( const var_key &key ) const
 {
     return global_variables::_common_get_value( key, values );
 }
 
-diag_value const *vehicle::maybe_get_value( const std::string &key ) const
+diag_value const *vehicle::maybe_get_value( const var_key &key ) const
 {
     return global_variables::_common_maybe_get_value( key, values );
 }
@@ -8647,7 +8647,7 @@ std::vector<std::reference_wrapper<const vehicle_part>> vehicle::real_parts() co
 std::set<int> vehicle::advance_precalc_mounts( const point_sm_ms &new_pos,
         map *here, const tripoint_bub_ms &src,
         const tripoint_rel_ms &dp, int ramp_offset, const bool adjust_pos,
-        std::set<int> parts_to_move )
+        std::set<int> parts_to_move, std::vector<tripoint_bub_ms> *vacated )
 {
     std::set<int> smzs;
     // when a vehicle part enters the low end of a down ramp, or the high end of an up ramp,
@@ -8678,7 +8678,11 @@ std::set<int> vehicle::advance_precalc_mounts( const point_sm_ms &new_pos,
     for( vehicle_part &prt : parts ) {
         index += 1;
         if( prt.is_real_or_active_fake() ) {
-            here->clear_vehicle_point_from_cache( this, src + prt.precalc[0] );
+            if( vacated != nullptr ) {
+                vacated->push_back( src + prt.precalc[0] );
+            } else {
+                here->clear_vehicle_point_from_cache( this, src + prt.precalc[0] );
+            }
         }
         // no parts means this is a normal horizontal or vertical move
         if( parts_to_move.empty() ) {
@@ -887,14 +887,14 @@ class vehicle
         static std::map<Vehicle *, float> search_connected_vehicles( const map &here, Vehicle *start );
     public:
         std::vector<std::string> chat_topics; // What it has to say.
-        void set_value( const std::string &key, diag_value value );
+        void set_value( const var_key &key, diag_value value );
         template <typename... Args>
-        void set_value( const std::string &key, Args... args ) {
+        void set_value( const var_key &key, Args... args ) {
             set_value( key, diag_value{ std::forward<Args>( args )... } );
         }
-        void remove_value( const std::string &key );
-        diag_value const &get_value( const std::string &key ) const;
-        diag_value const *maybe_get_value( const std::string &key ) const;
+        void remove_value( const var_key &key );
+        diag_value const &get_value( const var_key &key ) const;
+        diag_value const *maybe_get_value( const var_key &key ) const;
         void clear_values();
         void add_chat_topic( const std::string &topic );
         int get_passenger_count( bool hostile ) const;
@@ -1855,6 +1855,10 @@ class vehicle
                         const tripoint_rel_ms &dp,
                         bool just_detect, bool bash_floor = false );
 
+        // Bulk check of the projected footprint (see part_project_points) for horizontal movement.
+        // Returns true if no part can possibly collide, so the per-part collision pass can be skipped.
+        bool footprint_is_clear( map &here ) const;
+
         // Handle given part collision with vehicle, monster/NPC/player or terrain obstacle
         // Returns collision, which has type, impulse, part, & target.
         veh_collision part_collision( map &here, int part, const tripoint_abs_ms &p,
@@ -2295,10 +2299,13 @@ class vehicle
 
         // Updates the internal precalculated mount offsets after the vehicle has been displaced
         // used in map::displace_vehicle()
+        // If vacated is given, the old part positions are appended to it instead of being
+        // cleared from the map's vehicle cache, see map::move_vehicle_in_cache()
         std::set<int> advance_precalc_mounts( const point_sm_ms &new_pos, map *here,
                                               const tripoint_bub_ms &src,
                                               const tripoint_rel_ms &dp, int ramp_offset,
-                                              bool adjust_pos, std::set<int> parts_to_move );
+                                              bool adjust_pos, std::set<int> parts_to_move,
+                                              std::vector<tripoint_bub_ms> *vacated = nullptr );
         // make sure the vehicle is supported across z-levels or on the same z-level
         bool level_vehicle( map &here );
 
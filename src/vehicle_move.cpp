@@ -33,6 +33,7 @@
 #include "messages.h"
 #include "monster.h"
 #include "options.h"
+#include "pathfinding.h"
 #include "rng.h"
 #include "sounds.h"
 #include "string_formatter.h"
@@ -746,6 +747,10 @@ bool vehicle::collision( map &here, std::vector<veh_collision> &colls,
     const int sign_before = sgn( velocity_before );
     bool empty = true;
     part_project_points( dp );
+    // Open ground ahead, no need to check every part
+    if( !vertical && footprint_is_clear( here ) ) {
+        return !colls.empty();
+    }
     for( int p = 0; p < part_count(); p++ ) {
         const vehicle_part &vp = parts.at( p );
         if( vp.removed || !vp.is_real_or_active_fake() ) {
@@ -824,6 +829,55 @@ bool vehicle::collision( map &here, std::vector<veh_collision> &colls,
     return !colls.empty();
 }
 
+bool vehicle::footprint_is_clear( map &here ) const
+{
+    creature_tracker &creatures = get_creature_tracker();
+    bool empty = true;
+    for( const vehicle_part &vp : parts ) {
+        if( vp.removed || !vp.is_real_or_active_fake() ) {
+            continue;
+        }
+        const vpart_info &info = vp.info();
+        if( info.has_flag( VPFLAG_ROTOR ) ) {
+            // Rotors sweep a radius around the part, leave them to part_collision()
+            return false;
+        }
+        if( !vp.is_fake && info.location != vpart_location_structure ) {
+            continue;
+        }
+        empty = false;
+        const tripoint_bub_ms pos = here.get_bub( vp.next_pos );
+        if( !here.inbounds( pos ) ) {
+            return false;
+        }
+        // Terrain, furniture and other vehicles
+        const PathfindingFlags flags = here.get_pathfinding_cache_ref( pos.z() ).special[pos.xy()];
+        if( flags.is_set( PathfindingFlag::Uneven ) ) {
+            return false;
+        }
+        if( flags.is_set( PathfindingFlag::Vehicle ) ) {
+            const optional_vpart_position ovp = here.veh_at( pos );
+            if( ovp && &ovp->vehicle() != this ) {
+                return false;
+            }
+        }
+        // Field changes don't always dirty the pathfinding cache, so check them directly
+        if( here.impassable_field_at( pos ) ) {
+            return false;
+        }
+        // Passengers of any vehicle are ignored by part_collision(), everything else is a hit
+        const Creature *critter = creatures.creature_at( vp.next_pos, true );
+        if( critter != nullptr ) {
+            const Character *ch = critter->as_character();
+            if( ch == nullptr || !ch->in_vehicle ) {
+                return false;
+            }
+        }
+    }
+    // Vehicles with no structure are handled (and cleaned up) by the full pass
+    return !empty;
+}
+
 // A helper to make sure mass and density is always calculated the same way
 static void terrain_collision_data( map &here, const tripoint_bub_ms &p, bool bash_floor,
                                     float &mass, float &density, float &elastic )
@@ -70,6 +70,8 @@ static const oter_type_str_id oter_type_forest_water( "forest_water" );
 static const trait_id trait_CEPH_VISION( "CEPH_VISION" );
 static const trait_id trait_FEATHERS( "FEATHERS" );
 
+static const option_ref<std::string> option_USE_CELSIUS( "USE_CELSIUS" );
+
 /**
  * \defgroup Weather "Weather and its implications."
  * @{
@@ -606,10 +608,10 @@ std::string print_temperature( units::temperature temperature, int decimals )
         return string_format( "%.*f", decimals, value );
     };
 
-    if( get_option<std::string>( "USE_CELSIUS" ) == "celsius" ) {
+    if( option_USE_CELSIUS.get() == "celsius" ) {
         return string_format( pgettext( "temperature in Celsius", "%sC" ),
                               text( units::to_celsius( temperature ) ) );
-    } else if( get_option<std::string>( "USE_CELSIUS" ) == "kelvin" ) {
+    } else if( option_USE_CELSIUS.get() == "kelvin" ) {
         return string_format( pgettext( "temperature in Kelvin", "%sK" ),
                               text( units::to_kelvin( temperature ) ) );
     } else {
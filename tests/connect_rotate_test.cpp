@@ -1,7 +1,9 @@
 #if (defined(TILES))
 
+#include <array>
 #include <bitset>
 #include <map>
+#include <optional>
 #include <string>
 
 #include "avatar.h"
@@ -9,17 +11,27 @@
 #include "cata_tiles.h"
 #include "coordinates.h"
 #include "enums.h"
+#include "item.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "mapdata.h"
 #include "player_helpers.h"
 #include "point.h"
 #include "type_id.h"
+#include "units.h"
+#include "vehicle.h"
+#include "vpart_position.h"
+
+static const field_type_str_id field_fd_blood( "fd_blood" );
+
+static const itype_id itype_rock( "rock" );
 
 static const ter_str_id ter_t_floor( "t_floor" );
 static const ter_str_id ter_t_pavement( "t_pavement" );
 static const ter_str_id ter_t_wall( "t_wall" );
 
+static const vproto_id vehicle_prototype_test_shopping_cart( "test_shopping_cart" );
+
 class cata_tiles_test_helper
 {
     public:
@@ -29,6 +41,12 @@ class cata_tiles_test_helper
             cata_tiles::get_connect_values( tripoint_bub_ms( p ), subtile, rotation, connect_group,
                                             rotate_to_group, {} );
         }
+        static size_t static_layers_key( const tripoint_bub_ms &p ) {
+            const std::array<bool, 5> visible = {};
+            return cata_tiles::static_layers_key( tile_render_info(
+                    tile_render_info::common( p, 0 ),
+                    tile_render_info::sprite( lit_level::LIT, visible ) ) );
+        }
 };
 
 TEST_CASE( "walls_should_be_unconnected_without_nearby_walls", "[multitile][connects]" )
@@ -534,4 +552,44 @@ TEST_CASE( "unconnected_windows_rotate_to_indoor_floor", "[multitile][rotates]"
     }
 }
 
+TEST_CASE( "static_layer_key_changes_with_the_tile", "[tiles]" )
+{
+    map &here = get_map();
+    clear_map();
+    clear_avatar();
+
+    const tripoint_bub_ms pos = get_avatar().pos_bub() + point::east * 2;
+    const size_t before = cata_tiles_test_helper::static_layers_key( pos );
+    CHECK( cata_tiles_test_helper::static_layers_key( pos ) == before );
+
+    SECTION( "terrain of the tile" ) {
+        REQUIRE( here.ter_set( pos, ter_t_wall ) );
+        CHECK( cata_tiles_test_helper::static_layers_key( pos ) != before );
+    }
+    SECTION( "terrain of a neighbour" ) {
+        REQUIRE( here.ter_set( pos + point::north, ter_t_wall ) );
+        CHECK( cata_tiles_test_helper::static_layers_key( pos ) != before );
+    }
+    SECTION( "field on the tile" ) {
+        REQUIRE( here.add_field( pos, field_fd_blood, 1 ) );
+        const size_t with_field = cata_tiles_test_helper::static_layers_key( pos );
+        CHECK( with_field != before );
+        here.set_field_intensity( pos, field_fd_blood, 2 );
+        CHECK( cata_tiles_test_helper::static_layers_key( pos ) != with_field );
+    }
+    SECTION( "item on the tile" ) {
+        here.add_item( pos, item( itype_rock ) );
+        CHECK( cata_tiles_test_helper::static_layers_key( pos ) != before );
+    }
+    SECTION( "item in a vehicle on the tile" ) {
+        REQUIRE( here.add_vehicle( vehicle_prototype_test_shopping_cart, pos, 0_degrees, 0, 0 ) );
+        const std::optional<vpart_reference> cargo = here.veh_at( pos ).cargo();
+        REQUIRE( cargo );
+        const size_t with_vehicle = cata_tiles_test_helper::static_layers_key( pos );
+        CHECK( with_vehicle != before );
+        REQUIRE( cargo->vehicle().add_item( here, cargo->part(), item( itype_rock ) ) );
+        CHECK( cata_tiles_test_helper::static_layers_key( pos ) != with_vehicle );
+    }
+}
+
 #endif // SDL_TILES
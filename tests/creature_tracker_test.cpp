@@ -0,0 +1,91 @@
+#include <set>
+#include <string>
+
+#include "avatar.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "creature.h"
+#include "creature_tracker.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "monster.h"
+#include "player_helpers.h"
+
+static std::set<const monster *> monsters_in_radius( const tripoint_abs_ms &center, int radius )
+{
+    std::set<const monster *> found;
+    get_creature_tracker().for_each_monster_in_radius( center, radius, [&found]( monster & z ) {
+        found.insert( &z );
+    } );
+    return found;
+}
+
+TEST_CASE( "creature_tracker_radius_queries", "[creature_tracker][monster]" )
+{
+    clear_map();
+    clear_avatar();
+    map &here = get_map();
+    creature_tracker &creatures = get_creature_tracker();
+    get_player_character().setpos( here, tripoint_bub_ms( 30, 30, 0 ) );
+
+    const tripoint_bub_ms center( 60, 60, 0 );
+    const tripoint_abs_ms center_abs = here.get_abs( center );
+    monster &near_zombie = spawn_test_monster( "mon_zombie", center + tripoint::east * 3 );
+    monster &far_zombie = spawn_test_monster( "mon_zombie", center + tripoint::east * 30 );
+    monster &dog = spawn_test_monster( "mon_dog", center + tripoint::south * 5 );
+    REQUIRE( near_zombie.faction != dog.faction );
+
+    SECTION( "only monsters within the radius are visited" ) {
+        CHECK( monsters_in_radius( center_abs, 2 ).empty() );
+        CHECK( monsters_in_radius( center_abs, 3 ) == std::set<const monster *> { &near_zombie } );
+        CHECK( monsters_in_radius( center_abs, 5 ) ==
+               std::set<const monster *> { &near_zombie, &dog } );
+        CHECK( monsters_in_radius( center_abs, 30 ).size() == 3 );
+        // Other z-levels count towards the distance too.
+        CHECK( monsters_in_radius( center_abs + tripoint::above * 4, 3 ).empty() );
+        CHECK( monsters_in_radius( center_abs + tripoint::above * 4, 5 ).size() == 2 );
+    }
+
+    SECTION( "moved monsters are found at their new position" ) {
+        far_zombie.setpos( here, center + tripoint::north * 2 );
+        CHECK( monsters_in_radius( center_abs, 2 ) == std::set<const monster *> { &far_zombie } );
+        CHECK( monsters_in_radius( here.get_abs( center + tripoint::east * 30 ), 5 ).empty() );
+    }
+
+    SECTION( "removed and dead monsters are not visited" ) {
+        creatures.remove( near_zombie );
+        dog.set_hp( 0 );
+        dog.die( &here, nullptr );
+        CHECK( monsters_in_radius( center_abs, 10 ).empty() );
+        CHECK( monsters_in_radius( center_abs, 30 ) == std::set<const monster *> { &far_zombie } );
+    }
+
+    SECTION( "monsters can be filtered by faction" ) {
+        const mfaction_id dogs = dog.faction;
+        int visited = 0;
+        const auto only_dogs = [dogs]( const mfaction_id & faction ) {
+            return faction == dogs;
+        };
+        creatures.for_each_monster_in_radius( center_abs, 30, only_dogs, [&]( monster & z ) {
+            CHECK( &z == &dog );
+            ++visited;
+        } );
+        CHECK( visited == 1 );
+    }
+
+    SECTION( "nearest matching creature" ) {
+        const auto any = []( Creature & ) {
+            return true;
+        };
+        const auto not_zombie = [&near_zombie]( Creature & critter ) {
+            return &critter != &near_zombie;
+        };
+        const auto is_avatar = []( Creature & critter ) {
+            return critter.is_avatar();
+        };
+        CHECK( creatures.nearest_matching( center_abs, 30, any ) == &near_zombie );
+        CHECK( creatures.nearest_matching( center_abs, 30, not_zombie ) == &dog );
+        CHECK( creatures.nearest_matching( center_abs, 2, any ) == nullptr );
+        CHECK( creatures.nearest_matching( center_abs, 30, is_avatar ) == &get_avatar() );
+    }
+}
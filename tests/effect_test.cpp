@@ -581,6 +581,80 @@ TEST_CASE( "effect_body_part", "[effect][bodypart]" )
     CHECK_FALSE( eff_grabbed.get_bp() == body_part_arm_l.id() );
 }
 
+// Effect lookup
+// -------------
+// effects_map::might_have
+// Creature::has_effect
+// Creature::schedule_effect_removal
+//
+TEST_CASE( "effects_map_knows_which_types_are_present", "[effect]" )
+{
+    // More types than bits, so some of them share one
+    std::vector<efftype_id> types;
+    for( const auto &type : get_effect_types() ) {
+        types.push_back( type.first );
+    }
+    REQUIRE( types.size() > 64 );
+
+    effects_map effects;
+    for( const efftype_id &id : types ) {
+        CHECK_FALSE( effects.might_have( id ) );
+    }
+    for( size_t i = 0; i < types.size(); i += 2 ) {
+        effects[types[i]][body_part_arm_r] = effect();
+    }
+    effects.emplace( types[1], std::map<bodypart_id, effect>() );
+    CHECK( effects.might_have( types[1] ) );
+    for( size_t i = 0; i < types.size(); i += 2 ) {
+        CHECK( effects.might_have( types[i] ) );
+    }
+
+    for( size_t i = 0; i < types.size(); ++i ) {
+        if( i != 4 ) {
+            effects.erase( types[i] );
+        }
+    }
+    REQUIRE( effects.size() == 1 );
+    CHECK( effects.might_have( types[4] ) );
+
+    effects.clear();
+    CHECK_FALSE( effects.might_have( types[4] ) );
+}
+
+TEST_CASE( "effect_presence_follows_adding_and_removing", "[effect]" )
+{
+    monster mummy( pseudo_debug_mon );
+    REQUIRE_FALSE( mummy.has_effect( effect_grabbed ) );
+
+    mummy.add_effect( effect_source::empty(), effect_grabbed, 1_minutes, body_part_arm_r );
+    mummy.add_effect( effect_source::empty(), effect_debugged, 1_minutes );
+    CHECK( mummy.has_effect( effect_grabbed ) );
+    CHECK( mummy.has_effect( effect_grabbed, body_part_arm_r ) );
+    CHECK_FALSE( mummy.has_effect( effect_grabbed, body_part_arm_l ) );
+    CHECK_FALSE( mummy.has_effect( effect_bleed ) );
+    CHECK( mummy.get_effect( effect_bleed ).is_null() );
+
+    mummy.remove_effect( effect_grabbed );
+    CHECK_FALSE( mummy.has_effect( effect_grabbed ) );
+    CHECK( mummy.has_effect( effect_debugged ) );
+
+    mummy.clear_effects();
+    CHECK_FALSE( mummy.has_effect( effect_debugged ) );
+
+    // Scheduled changes are applied in order when the character processes effects
+    clear_map();
+    clear_avatar();
+    Character &guy = get_player_character();
+    guy.schedule_effect( effect_debugged, 1_minutes );
+    guy.schedule_effect_removal( effect_debugged );
+    CHECK_FALSE( guy.has_effect( effect_debugged ) );
+    guy.process_effects();
+    CHECK_FALSE( guy.has_effect( effect_debugged ) );
+    guy.schedule_effect( effect_debugged, 1_minutes );
+    guy.process_effects();
+    CHECK( guy.has_effect( effect_debugged ) );
+}
+
 // Effect modifiers
 // ----------------
 // TODO:
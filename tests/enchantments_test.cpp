@@ -3,6 +3,7 @@
 #include <string>
 
 #include "avatar.h"
+#include "bionics.h"
 #include "bodypart.h"
 #include "calendar.h"
 #include "cata_catch.h"
@@ -14,10 +15,12 @@
 #include "game.h"
 #include "item.h"
 #include "item_location.h"
+#include "magic_enchantment.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "messages.h"
 #include "monster.h"
+#include "pimpl.h"
 #include "player_helpers.h"
 #include "point.h"
 #include "talker.h"
@@ -53,6 +56,8 @@ static const mtype_id pseudo_debug_mon( "pseudo_debug_mon" );
 
 static const skill_id skill_melee( "melee" );
 
+static const trait_id
+trait_TEST_ENCH_CONDITIONAL_MUTATION( "TEST_ENCH_CONDITIONAL_MUTATION" );
 static const trait_id trait_TEST_ENCH_MUTATION( "TEST_ENCH_MUTATION" );
 
 static void advance_turn( Character &guy )
@@ -156,6 +161,51 @@ TEST_CASE( "mutation_enchantments", "[enchantments][mutations]" )
     test_generic_ench( p, enc_test );
 }
 
+// Updates the enchantment cache the way it is done every turn and checks the result is the same
+// as recalculating it from scratch.
+static void check_update_matches_recalculate( Character &guy )
+{
+    guy.update_enchantment_cache();
+    const enchant_cache updated = *guy.enchantment_cache;
+    guy.recalculate_enchantment_cache();
+    CHECK( updated == *guy.enchantment_cache );
+    CHECK( updated.details.size() == guy.enchantment_cache->details.size() );
+    CHECK( updated.hit_me_effect.size() == guy.enchantment_cache->hit_me_effect.size() );
+    CHECK( updated.get_value_add( enchant_vals::mod::SPEED ) ==
+           guy.enchantment_cache->get_value_add( enchant_vals::mod::SPEED ) );
+}
+
+TEST_CASE( "enchantment_cache_update_matches_recalculation", "[enchantments]" )
+{
+    avatar p;
+    clear_character( p );
+    p.str_max = 8;
+    p.add_bionic( test_bio_ench );
+    p.toggle_trait( trait_TEST_ENCH_MUTATION );
+    p.toggle_trait( trait_TEST_ENCH_CONDITIONAL_MUTATION );
+    p.recalculate_enchantment_cache();
+    check_update_matches_recalculate( p );
+    CHECK( p.enchantment_cache->get_value_add( enchant_vals::mod::SPEED ) == 0 );
+
+    // Nothing below tells the character its enchantments have changed.
+    SECTION( "conditional enchantments follow the character" ) {
+        p.str_max = 12;
+        check_update_matches_recalculate( p );
+        CHECK( p.enchantment_cache->get_value_add( enchant_vals::mod::SPEED ) == 12 );
+        p.str_max = 14;
+        check_update_matches_recalculate( p );
+        CHECK( p.enchantment_cache->get_value_add( enchant_vals::mod::SPEED ) == 14 );
+    }
+
+    SECTION( "static enchantments follow their sources" ) {
+        // TEST_ENCH from both the bionic and the mutation
+        CHECK( p.enchantment_cache->get_value_add( enchant_vals::mod::DEXTERITY ) == 2 );
+        p.my_bionics->clear();
+        check_update_matches_recalculate( p );
+        CHECK( p.enchantment_cache->get_value_add( enchant_vals::mod::DEXTERITY ) == 1 );
+    }
+}
+
 TEST_CASE( "Enchantments_change_stats", "[magic][enchantments]" )
 {
     clear_map();
@@ -1,4 +1,5 @@
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "calendar.h"
@@ -26,6 +27,47 @@ TEST_CASE( "construct_event", "[event]" )
     CHECK( e.get<int>( "exp" ) == 100 );
 }
 
+TEST_CASE( "event_typed_field_access", "[event]" )
+{
+    constexpr event_type type = event_type::character_kills_monster;
+    static_assert( cata::event::field_index<type>( "killer" ) == 0 );
+    static_assert( cata::event::field_index<type>( "exp" ) == 2 );
+    static_assert( cata::event::field_index<type>( "no_such_field" ) == 3 );
+
+    cata::event e = cata::event::make<type>( character_id( 7 ), zombie, 100 );
+    CHECK( e.get<type, cata::event::field_index<type>( "killer" )>() == character_id( 7 ) );
+    CHECK( e.get<type, cata::event::field_index<type>( "victim_type" )>() == zombie );
+    CHECK( e.get<type, cata::event::field_index<type>( "exp" )>() == 100 );
+    CHECK( e.get_variant_or_void( "no_such_field" ) == cata_variant() );
+}
+
+TEST_CASE( "event_payload_matches_data", "[event]" )
+{
+    cata::event e = cata::event::make<event_type::character_kills_monster>(
+                        character_id( 7 ), zombie, 100 );
+    REQUIRE( e.payload() );
+    const cata::event::data_type data = e.data();
+    CHECK( data.size() == 3 );
+    CHECK( data.at( "exp" ) == cata_variant( 100 ) );
+
+    // Building an event from the same map gives the same payload
+    cata::event copy( e.type(), e.time(), cata::event::data_type( data ) );
+    REQUIRE( copy.payload() );
+    CHECK( *copy.payload() == *e.payload() );
+    CHECK( cata::event_payload_hash()( *copy.payload() ) ==
+           cata::event_payload_hash()( *e.payload() ) );
+
+    // A map with other fields is kept as it is
+    cata::event::data_type other = data;
+    other.erase( "exp" );
+    other.emplace( "extra", cata_variant( 3 ) );
+    cata::event dynamic( e.type(), e.time(), std::move( other ) );
+    CHECK( !dynamic.payload() );
+    CHECK( dynamic.get<int>( "extra" ) == 3 );
+    CHECK( dynamic.get_variant_or_void( "exp" ) == cata_variant() );
+    CHECK( dynamic.data().size() == 3 );
+}
+
 struct test_subscriber : public event_subscriber {
     using event_subscriber::notify;
     void notify( const cata::event &e ) override {
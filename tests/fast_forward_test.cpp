@@ -0,0 +1,111 @@
+#include <string>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "do_turn.h"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "player_activity.h"
+#include "player_helpers.h"
+#include "type_id.h"
+
+static const activity_id ACT_WAIT( "ACT_WAIT" );
+
+TEST_CASE( "fast_forward_only_while_nothing_is_going_on", "[sleep][activity]" )
+{
+    clear_map();
+    clear_avatar();
+    avatar &u = get_avatar();
+    map &here = get_map();
+    u.setpos( here, tripoint_bub_ms( 20, 20, 0 ) );
+    // Forget whatever earlier tests left in view.
+    g->mon_info_update();
+
+    CHECK_FALSE( can_fast_forward( u ) );
+
+    SECTION( "sleeping" ) {
+        u.fall_asleep();
+        CHECK( can_fast_forward( u ) );
+
+        spawn_test_monster( "mon_zombie", tripoint_bub_ms( 100, 100, 0 ) );
+        CHECK( can_fast_forward( u ) );
+
+        spawn_test_monster( "mon_zombie", tripoint_bub_ms( 25, 20, 0 ) );
+        CHECK_FALSE( can_fast_forward( u ) );
+    }
+
+    SECTION( "busy with an activity" ) {
+        // Awake activities react to effects every turn, so they are never fast forwarded.
+        u.assign_activity( player_activity( ACT_WAIT, to_moves<int>( 1_hours ) ) );
+        CHECK_FALSE( can_fast_forward( u ) );
+    }
+}
+
+TEST_CASE( "fast_forward_looks_for_hostiles_once_per_step", "[sleep]" )
+{
+    calendar::turn = calendar::turn_zero;
+    clear_map();
+    clear_avatar();
+    avatar &u = get_avatar();
+    map &here = get_map();
+    u.setpos( here, tripoint_bub_ms( 20, 20, 0 ) );
+    // Forget whatever earlier tests left in view.
+    g->mon_info_update();
+    u.fall_asleep();
+
+    REQUIRE( fast_forward_this_turn( u ) );
+    u.update_body_in_steps( true );
+    calendar::turn += 1_turns;
+
+    // Between steps the previous answer stands.
+    spawn_test_monster( "mon_zombie", tripoint_bub_ms( 25, 20, 0 ) );
+    CHECK( fast_forward_this_turn( u ) );
+
+    SECTION( "until the next step" ) {
+        calendar::turn = calendar::turn_zero + avatar::body_update_step;
+        CHECK_FALSE( fast_forward_this_turn( u ) );
+    }
+
+    SECTION( "unless the avatar wakes up" ) {
+        u.wake_up();
+        CHECK_FALSE( fast_forward_this_turn( u ) );
+    }
+}
+
+// Fast forwarding relies on the body coming out the same when it is updated in steps.
+TEST_CASE( "avatar_body_updated_in_steps_matches_updating_every_turn", "[sleep]" )
+{
+    calendar::turn = calendar::turn_zero;
+    clear_avatar();
+    avatar &in_steps = get_avatar();
+    avatar every_turn;
+    every_turn.setpos( get_map(), in_steps.pos_bub() );
+    const auto prepare = []( avatar & u ) {
+        u.set_stored_kcal( u.get_healthy_kcal() );
+        u.set_sleepiness( 500 );
+        u.set_thirst( 100 );
+        u.fall_asleep( 10_hours );
+    };
+    prepare( every_turn );
+    prepare( in_steps );
+    // So that both start out remembering they were asleep.
+    calendar::turn += 1_turns;
+    every_turn.update_body_in_steps( false );
+    in_steps.update_body_in_steps( false );
+
+    // End in the middle of a step, so that leaving the steps has turns to catch up on.
+    const int turns = to_turns<int>( 2_hours ) + to_turns<int>( avatar::body_update_step ) / 2;
+    for( int i = 0; i < turns; ++i ) {
+        calendar::turn += 1_turns;
+        every_turn.update_body_in_steps( false );
+        in_steps.update_body_in_steps( i + 1 < turns );
+    }
+
+    CHECK( in_steps.get_sleepiness() == every_turn.get_sleepiness() );
+    CHECK( in_steps.get_thirst() == every_turn.get_thirst() );
+    CHECK( in_steps.get_stored_kcal() == every_turn.get_stored_kcal() );
+    CHECK( in_steps.get_daily_sleep() == every_turn.get_daily_sleep() );
+}
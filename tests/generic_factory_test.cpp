@@ -123,6 +123,33 @@ TEST_CASE( "generic_factory_repeated_invalidation", "[generic_factory]" )
     }
 }
 
+TEST_CASE( "generic_factory_finalized_lookup", "[generic_factory]" )
+{
+    generic_factory<test_obj> test_factory( "test_factory" );
+    for( int i = 0; i < 100; ++i ) {
+        test_factory.insert( { test_obj_id( "id_" + std::to_string( i ) ), std::to_string( i ) } );
+    }
+    test_factory.finalize();
+
+    // fresh string_ids, so none of them has a cached int id yet
+    for( int i = 0; i < 100; ++i ) {
+        const test_obj_id id( "id_" + std::to_string( i ) );
+        CHECK( test_factory.is_valid( id ) );
+        CHECK( test_factory.obj( test_obj_id( "id_" + std::to_string( i ) ) ).value ==
+               std::to_string( i ) );
+    }
+    CHECK_FALSE( test_factory.is_valid( test_obj_id( "id_100" ) ) );
+    CHECK_FALSE( test_factory.is_valid( test_obj_id( "non_existent_id" ) ) );
+
+    // inserting after finalize must still be visible
+    test_factory.insert( { test_obj_id( "id_100" ), "100" } );
+    CHECK( test_factory.is_valid( test_obj_id( "id_100" ) ) );
+    CHECK( test_factory.obj( test_obj_id( "id_100" ) ).value == "100" );
+    test_factory.finalize();
+    CHECK( test_factory.is_valid( test_obj_id( "id_100" ) ) );
+    CHECK( test_factory.obj( test_obj_id( "id_42" ) ).value == "42" );
+}
+
 TEST_CASE( "generic_factory_common_null_ids", "[generic_factory]" )
 {
     CHECK( itype_id::NULL_ID().is_null() );
@@ -222,6 +249,11 @@ TEST_CASE( "generic_factory_lookup_benchmark", "[.][generic_factory][benchmark]"
     BENCHMARK( "single lookup" ) {
         return test_factory.obj( id_200 ).value;
     };
+
+    test_factory.finalize();
+    BENCHMARK( "lookup of a new string_id after finalize" ) {
+        return test_factory.obj( test_obj_id( id_200.str() ) ).value;
+    };
 }
 
 TEST_CASE( "string_id_compare_benchmark", "[.][generic_factory][string_id][benchmark]" )
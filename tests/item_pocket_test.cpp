@@ -2993,3 +2993,53 @@ TEST_CASE( "unload_from_spillable_container", "[item][pocket]" )
         }
     }
 }
+
+TEST_CASE( "removing_pocket_items_keeps_the_rest_in_place", "[item][pocket]" )
+{
+    item backpack( itype_test_backpack );
+    item box( itype_test_box );
+    REQUIRE( box.put_in( item( itype_test_rock ), pocket_type::CONTAINER ).success() );
+    REQUIRE( backpack.put_in( box, pocket_type::CONTAINER ).success() );
+    item *nested_box = &backpack.only_item();
+    item *nested_rock = &nested_box->only_item();
+
+    CHECK( backpack.all_items_ptr( pocket_type::CONTAINER ).size() == 2 );
+
+    for( int i = 0; i < 20; ++i ) {
+        REQUIRE( backpack.put_in( item( itype_test_rock ), pocket_type::CONTAINER ).success() );
+    }
+    std::list<item> removed = backpack.remove_items_with( [nested_rock]( const item & it ) {
+        return it.typeId() == itype_test_rock && &it != nested_rock;
+    } );
+    CHECK( removed.size() == 20 );
+    CHECK( &backpack.only_item() == nested_box );
+    CHECK( &nested_box->only_item() == nested_rock );
+    CHECK( backpack.all_items_ptr( pocket_type::CONTAINER ).size() == 2 );
+}
+
+TEST_CASE( "visiting_nested_items_matches_all_items_ptr", "[item][pocket]" )
+{
+    item backpack( itype_test_backpack );
+    item box( itype_test_box );
+    REQUIRE( box.put_in( item( itype_test_rock ), pocket_type::CONTAINER ).success() );
+    REQUIRE( box.put_in( item( itype_test_apple ), pocket_type::CONTAINER ).success() );
+    REQUIRE( backpack.put_in( box, pocket_type::CONTAINER ).success() );
+    REQUIRE( backpack.put_in( item( itype_test_rock ), pocket_type::CONTAINER ).success() );
+
+    const item &const_backpack = backpack;
+    std::list<const item *> visited;
+    const_backpack.visit_items_top_recursive( pocket_type::CONTAINER,
+    [&visited]( const item & it ) {
+        visited.push_back( &it );
+    } );
+    CHECK( visited.size() == 4 );
+    CHECK( visited == const_backpack.all_items_ptr( pocket_type::CONTAINER ) );
+
+    int rocks = 0;
+    backpack.visit_items_top_recursive( pocket_type::CONTAINER, [&rocks]( item & it ) {
+        if( it.typeId() == itype_test_rock ) {
+            ++rocks;
+        }
+    } );
+    CHECK( rocks == 2 );
+}
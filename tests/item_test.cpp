@@ -381,6 +381,34 @@ TEST_CASE( "item_variables_round-trip_accurately", "[item]" )
     CHECK( i.get_var( "C", tripoint_abs_ms::zero ) == tripoint_abs_ms( 2, 3, 4 ) );
 }
 
+TEST_CASE( "item_flag_lookups_match_flag_sets", "[item][flag]" )
+{
+    item hammer( itype_hammer );
+    for( const json_flag &f : json_flag::get_all() ) {
+        CAPTURE( f.id.str() );
+        const bool in_type = hammer.type->get_flags().count( f.id ) > 0;
+        CHECK( hammer.type->has_flag( f.id ) == in_type );
+        CHECK( hammer.has_flag( f.id ) == in_type );
+        CHECK_FALSE( hammer.has_own_flag( f.id ) );
+    }
+
+    hammer.set_flag( json_flag_FILTHY );
+    CHECK( hammer.has_flag( json_flag_FILTHY ) );
+    CHECK( hammer.has_own_flag( json_flag_FILTHY ) );
+    CHECK_FALSE( hammer.has_own_flag( json_flag_HOT ) );
+
+    item copy( hammer );
+    CHECK( copy.has_flag( json_flag_FILTHY ) );
+
+    hammer.unset_flag( json_flag_FILTHY );
+    CHECK_FALSE( hammer.has_flag( json_flag_FILTHY ) );
+    CHECK_FALSE( hammer.has_own_flag( json_flag_FILTHY ) );
+    CHECK( copy.has_flag( json_flag_FILTHY ) );
+
+    copy.unset_flags();
+    CHECK_FALSE( copy.has_flag( json_flag_FILTHY ) );
+}
+
 TEST_CASE( "water_affect_items_while_swimming_check", "[item][water][swimming]" )
 {
     avatar &guy = get_avatar();
@@ -0,0 +1,71 @@
+#include <memory>
+#include <string>
+
+#include "cata_catch.h"
+#include "lru_cache.h"
+#include "point.h"
+
+TEST_CASE( "lru_cache_evicts_least_recently_used", "[lru_cache][nogame]" )
+{
+    lru_cache<point, int> cache;
+    for( int i = 0; i < 4; ++i ) {
+        cache.insert( 4, point( i, 0 ), i );
+    }
+    CHECK( cache.size() == 4 );
+
+    // Reading an entry makes it the most recently used one.
+    CHECK( cache.get( point( 0, 0 ), -1 ) == 0 );
+    cache.insert( 4, point( 4, 0 ), 4 );
+    CHECK( cache.size() == 4 );
+    CHECK( cache.get( point( 1, 0 ), -1 ) == -1 );
+    CHECK( cache.get( point( 0, 0 ), -1 ) == 0 );
+
+    // So does overwriting one.
+    cache.insert( 4, point( 2, 0 ), 20 );
+    cache.insert( 4, point( 5, 0 ), 5 );
+    CHECK( cache.get( point( 3, 0 ), -1 ) == -1 );
+    CHECK( cache.get( point( 2, 0 ), -1 ) == 20 );
+    CHECK( cache.get( point( 4, 0 ), -1 ) == 4 );
+    CHECK( cache.get( point( 5, 0 ), -1 ) == 5 );
+
+    cache.remove( point( 4, 0 ) );
+    CHECK( cache.size() == 3 );
+    CHECK( cache.get( point( 4, 0 ), -1 ) == -1 );
+
+    // A smaller limit trims the cache down to it.
+    cache.insert( 2, point( 6, 0 ), 6 );
+    CHECK( cache.size() == 2 );
+    CHECK( cache.get( point( 6, 0 ), -1 ) == 6 );
+
+    cache.clear();
+    CHECK( cache.size() == 0 );
+    CHECK( cache.get( point( 6, 0 ), -1 ) == -1 );
+}
+
+TEST_CASE( "lru_cache_many_keys", "[lru_cache][nogame]" )
+{
+    lru_cache<point, int> cache;
+    constexpr int limit = 1000;
+    for( int i = 0; i <= 10 * limit; ++i ) {
+        cache.insert( limit, point( i % 97, i ), i );
+        if( i % 3 == 0 ) {
+            cache.remove( point( ( i - 1 ) % 97, i - 1 ) );
+        }
+    }
+    CHECK( cache.size() == static_cast<size_t>( limit ) );
+    for( int i = 10 * limit; i >= 9 * limit; --i ) {
+        const int expected = i % 3 == 2 ? -1 : i;
+        CHECK( cache.get( point( i % 97, i ), -1 ) == expected );
+    }
+}
+
+TEST_CASE( "lru_cache_releases_removed_values", "[lru_cache][nogame]" )
+{
+    lru_cache<std::string, std::shared_ptr<int>> cache;
+    std::shared_ptr<int> value = std::make_shared<int>( 1 );
+    cache.insert( 8, "a", value );
+    CHECK( value.use_count() == 2 );
+    cache.remove( "a" );
+    CHECK( value.use_count() == 1 );
+    CHECK( cache.get( "a", nullptr ) == nullptr );
+}
@@ -5,10 +5,13 @@
 
 #include "cata_catch.h"
 #include "coordinates.h"
+#include "json.h"
+#include "json_loader.h"
 #include "lru_cache.h"
 #include "map.h"
 #include "map_memory.h"
 #include "map_scale_constants.h"
+#include "memory_fast.h"
 #include "point.h"
 
 static constexpr tripoint_abs_ms p1{ -SEEX - 2, -SEEY - 3, -1 };
@@ -122,7 +125,55 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     CHECK( mt.get_dec_rotation() == 0 );
 }
 
-// TODO: map memory save / load
+TEST_CASE( "map_memory_region_round_trip", "[map_memory]" )
+{
+    mm_region reg;
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            reg.submaps[x][y] = make_shared_fast<mm_submap>();
+        }
+    }
+    memorized_tile floor;
+    floor.set_ter_id( "t_floor" );
+    floor.symbol = '.';
+    memorized_tile chair = floor;
+    chair.set_dec_id( "f_chair" );
+    chair.set_dec_rotation( 2 );
+    chair.set_dec_subtile( 1 );
+    for( int x = 0; x < SEEX; x++ ) {
+        reg.submaps[0][0]->set_tile( point_sm_ms( x, 0 ), x % 2 ? chair : floor );
+        reg.submaps[3][5]->set_tile( point_sm_ms( x, 2 ), floor );
+    }
+    CHECK( reg.is_dirty() );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    reg.serialize( jsout );
+    const std::string data = os.str();
+    // Each id is written once, in the region palette
+    CHECK( data.find( "t_floor" ) == data.rfind( "t_floor" ) );
+    CHECK( data.find( "f_chair" ) == data.rfind( "f_chair" ) );
+
+    mm_region loaded;
+    loaded.deserialize( json_loader::from_string( data ) );
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            CAPTURE( x, y );
+            CHECK( loaded.submaps[x][y]->is_empty() == reg.submaps[x][y]->is_empty() );
+            for( int sy = 0; sy < SEEY; sy++ ) {
+                for( int sx = 0; sx < SEEX; sx++ ) {
+                    const point_sm_ms p( sx, sy );
+                    CHECK( loaded.submaps[x][y]->get_tile( p ) == reg.submaps[x][y]->get_tile( p ) );
+                }
+            }
+        }
+    }
+    const memorized_tile &mt = loaded.submaps[0][0]->get_tile( point_sm_ms( 1, 0 ) );
+    CHECK( mt.get_ter_id() == "t_floor" );
+    CHECK( mt.get_dec_id() == "f_chair" );
+    CHECK( mt.get_dec_rotation() == 2 );
+    CHECK( mt.get_dec_subtile() == 1 );
+}
 
 #include <chrono>
 
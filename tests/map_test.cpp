@@ -193,6 +193,34 @@ TEST_CASE( "place_player_can_safely_move_multiple_submaps" )
     get_map().check_submap_active_item_consistency();
 }
 
+TEST_CASE( "mapgen_jobs_generate_ahead_of_bubble", "[map][mapgen]" )
+{
+    clear_overmaps();
+    map &here = get_map();
+    mapgen_jobs::queue_ahead_of_bubble( here, point_rel_sm::zero );
+    CHECK( mapgen_jobs::pending() == 0 );
+
+    mapgen_jobs::queue_ahead_of_bubble( here, point_rel_sm::east );
+    const size_t queued = mapgen_jobs::pending();
+    REQUIRE( queued > 2 );
+    // Only the column of tiles east of the bubble, which is one tile longer at either end
+    CHECK( queued <= static_cast<size_t>( MAPSIZE / 2 + 3 ) );
+
+    CHECK( mapgen_jobs::run( 2 ) == 2 );
+    CHECK( mapgen_jobs::pending() == queued - 2 );
+
+    // Generated tiles are in MAPBUFFER and aren't queued again
+    mapgen_jobs::queue_ahead_of_bubble( here, point_rel_sm::east );
+    CHECK( mapgen_jobs::pending() == queued - 2 );
+
+    // Moving diagonally queues a row as well as a column
+    mapgen_jobs::queue_ahead_of_bubble( here, point_rel_sm::south_east );
+    CHECK( mapgen_jobs::pending() > queued );
+
+    mapgen_jobs::clear();
+    CHECK( mapgen_jobs::pending() == 0 );
+}
+
 TEST_CASE( "inactive_container_with_active_contents", "[active_item][map]" )
 {
     map &here = get_map();
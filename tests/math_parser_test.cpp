@@ -8,6 +8,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "avatar.h"
 #include "cata_catch.h"
@@ -19,6 +20,7 @@
 #include "math_parser.h"
 #include "math_parser_diag_value.h"
 #include "math_parser_func.h"
+#include "math_parser_impl.h"
 #include "math_parser_type.h"
 #include "npc.h"
 #include "point.h"
@@ -435,3 +437,117 @@ TEST_CASE( "math_parser_dialogue_integration", "[math_parser]" )
     CHECK( get_avatar().get_stamina() == 459 );
 
 }
+
+static thingie math_num( double val )
+{
+    return thingie{ val };
+}
+
+static thingie math_var( var_type type, std::string const &name )
+{
+    return thingie{ std::in_place_type_t<var>(), type, name };
+}
+
+static thingie math_oper( thingie l, thingie r, binary_op::f_t op )
+{
+    return thingie{ std::in_place_type_t<oper>(), std::move( l ), std::move( r ), op };
+}
+
+// u_x * 2 + n_x / ( x + 1 ) - max( u_x, n_x, 3 ) * ( 2 ^ 3 - 1 ) + ( x > 50 ? u_x : sqrt( 16 ) )
+static thingie math_bytecode_test_tree()
+{
+    thingie const u_x = math_var( var_type::u, "x" );
+    thingie const n_x = math_var( var_type::npc, "x" );
+    thingie const x = math_var( var_type::global, "x" );
+
+    thingie const scaled = math_oper( u_x, math_num( 2 ), math_opers::mul );
+    thingie const ratio = math_oper( n_x, math_oper( x, math_num( 1 ), math_opers::add ),
+                                     math_opers::div );
+    thingie const maxed{ std::in_place_type_t<func>(),
+                         std::vector<thingie>{ u_x, n_x, math_num( 3 ) }, math_func::f_t{ max } };
+    thingie const eight = math_oper( math_num( 2 ), math_num( 3 ), math_opers::math_pow );
+    thingie const seven = math_oper( eight, math_num( 1 ), math_opers::sub );
+    thingie const sqrted{ std::in_place_type_t<func>(), std::vector<thingie>{ math_num( 16 ) },
+                          math_func::f_t{ sqrt } };
+    thingie const tern{ std::in_place_type_t<ternary>(),
+                        math_oper( x, math_num( 50 ), math_opers::gt ), u_x, sqrted };
+
+    thingie const sum = math_oper( scaled, ratio, math_opers::add );
+    thingie const product = math_oper( maxed, seven, math_opers::mul );
+    thingie const diff = math_oper( sum, product, math_opers::sub );
+    return math_oper( diff, tern, math_opers::add );
+}
+
+TEST_CASE( "math_parser_bytecode", "[math_parser]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    global_variables &globvars = get_globals();
+    math_exp testexp;
+
+    SECTION( "bytecode matches the tree" ) {
+        thingie const tree = math_bytecode_test_tree();
+        math_program prog;
+        REQUIRE( prog.compile( tree ) );
+        for( double x : { 0.0, 7.5, 100.0 } ) {
+            globvars.set_global_value( "x", x );
+            get_avatar().set_value( "x", x * 2 );
+            dude.set_value( "x", x - 3 );
+            CAPTURE( x );
+            CHECK( prog.eval( d ) == Approx( tree.eval( d ) ) );
+        }
+    }
+
+    SECTION( "variables are read on every evaluation" ) {
+        CHECK( testexp.parse( "u_y * 2 + ( n_y > 1 ? 10 : 20 ) + max( u_y, 3 )" ) );
+        get_avatar().set_value( "y", 1 );
+        dude.set_value( "y", 0 );
+        CHECK( testexp.eval( d ) == Approx( 25 ) );
+        get_avatar().set_value( "y", 6 );
+        dude.set_value( "y", 2 );
+        CHECK( testexp.eval( d ) == Approx( 28 ) );
+    }
+
+    SECTION( "random functions are not folded" ) {
+        CHECK( testexp.parse( "rng( 0, 1000000 ) + 2 * 3" ) );
+        double const first = testexp.eval( d );
+        bool differs = false;
+        for( int i = 0; i < 10 && !differs; i++ ) {
+            differs = testexp.eval( d ) != first;
+        }
+        CHECK( differs );
+    }
+
+    SECTION( "deep expressions" ) {
+        // 1 - ( 1 - ( ... - ( 1 - x ) ) ) keeps every 1 on the stack until x is read
+        std::string str = "z";
+        for( int i = 0; i < 40; i++ ) {
+            str = "1 - ( " + str + " )";
+        }
+        globvars.set_global_value( "z", 5 );
+        CHECK( testexp.parse( str ) );
+        CHECK( testexp.eval( d ) == Approx( 5 ) );
+        globvars.set_global_value( "z", -2 );
+        CHECK( testexp.eval( d ) == Approx( -2 ) );
+    }
+}
+
+TEST_CASE( "math_parser_bytecode_benchmark", "[.][math_parser][benchmark]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    get_globals().set_global_value( "x", 12 );
+    get_avatar().set_value( "x", 4 );
+    dude.set_value( "x", 9 );
+
+    thingie const tree = math_bytecode_test_tree();
+    math_program prog;
+    REQUIRE( prog.compile( tree ) );
+
+    BENCHMARK( "tree walk" ) {
+        return tree.eval( d );
+    };
+    BENCHMARK( "bytecode" ) {
+        return prog.eval( d );
+    };
+}
@@ -1,15 +1,22 @@
 #include <string>
 
+#include "avatar.h"
 #include "calendar.h"
 #include "cata_catch.h"
 #include "coordinates.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "monster.h"
+#include "npc.h"
+#include "player_helpers.h"
 #include "point.h"
 #include "type_id.h"
 
 static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_wall( "t_wall" );
+
+static const trait_id trait_CAMO2( "CAMO2" );
+static const trait_id trait_CRAFTY( "CRAFTY" );
 
 static monster &spawn_and_clear( const tripoint_bub_ms &pos, bool set_floor )
 {
@@ -74,3 +81,57 @@ TEST_CASE( "monsters_should_not_see_through_floors", "[vision]" )
     CHECK( sky.sees( here, distant ) );
     CHECK( distant.sees( here, sky ) );
 }
+
+TEST_CASE( "monster_line_of_sight_follows_movement_and_terrain", "[vision]" )
+{
+    map &here = get_map();
+
+    calendar::turn = midday;
+    clear_map( -2, 1 );
+    monster &watcher = spawn_and_clear( { 5, 5, 0 }, true );
+    monster &target = spawn_and_clear( { 5, 9, 0 }, true );
+    CHECK( watcher.sees( here, target ) );
+    CHECK( target.sees( here, watcher ) );
+
+    here.ter_set( tripoint_bub_ms( 5, 7, 0 ), ter_t_wall );
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0 );
+    CHECK( !watcher.sees( here, target ) );
+    CHECK( !target.sees( here, watcher ) );
+
+    // Moving out from behind the wall is noticed without rebuilding the map caches.
+    target.setpos( here, tripoint_bub_ms( 9, 9, 0 ) );
+    CHECK( watcher.sees( here, target ) );
+    CHECK( target.sees( here, watcher ) );
+    target.setpos( here, tripoint_bub_ms( 5, 9, 0 ) );
+    CHECK( !watcher.sees( here, target ) );
+    CHECK( !target.sees( here, watcher ) );
+}
+
+TEST_CASE( "npc_does_not_see_a_stealthy_avatar_at_range", "[vision][npc]" )
+{
+    map &here = get_map();
+
+    clear_map();
+    clear_avatar();
+    avatar &u = get_avatar();
+    u.setpos( here, tripoint_bub_ms( 30, 60, 0 ) );
+    npc &guy = spawn_npc( point_bub_ms( 70, 60 ), "thug" );
+    guy.recalc_sight_limits();
+    set_time( midday );
+
+    const int range = guy.vision_range_to( here, u.pos_bub( here ) );
+    REQUIRE( range >= 40 );
+    CHECK( guy.sees( here, u ) );
+
+    // Stealth shortens the range at which the avatar can be seen to 40%.
+    u.set_mutation( trait_CRAFTY );
+    u.set_mutation( trait_CAMO2 );
+    u.recalculate_enchantment_cache();
+    REQUIRE( u.visibility() == 40 );
+    REQUIRE( range * 40 / 100 < 40 );
+    CHECK_FALSE( guy.sees( here, u ) );
+
+    guy.setpos( here, tripoint_bub_ms( 40, 60, 0 ) );
+    CHECK( guy.sees( here, u ) );
+}
@@ -20,6 +20,7 @@
 #include "player_helpers.h"
 #include "talker.h"
 #include "type_id.h"
+#include "vitamin.h"
 
 static const effect_on_condition_id effect_on_condition_changing_mutate2( "changing_mutate2" );
 
@@ -38,11 +39,13 @@ static const mutation_category_id mutation_category_TROGLOBITE( "TROGLOBITE" );
 
 static const trait_id trait_BEAK( "BEAK" );
 static const trait_id trait_BEAK_PECK( "BEAK_PECK" );
+static const trait_id trait_BLOODFEEDER( "BLOODFEEDER" );
 static const trait_id trait_EAGLEEYED( "EAGLEEYED" );
 static const trait_id trait_FELINE_EARS( "FELINE_EARS" );
 static const trait_id trait_GOURMAND( "GOURMAND" );
 static const trait_id trait_MYOPIC( "MYOPIC" );
 static const trait_id trait_QUICK( "QUICK" );
+static const trait_id trait_RESISTANT_GENETICS( "RESISTANT_GENETICS" );
 static const trait_id trait_SMELLY( "SMELLY" );
 static const trait_id trait_STR_ALPHA( "STR_ALPHA" );
 static const trait_id trait_STR_UP( "STR_UP" );
@@ -64,6 +67,7 @@ static const trait_id trait_WINGS_BIRD( "WINGS_BIRD" );
 static const vitamin_id vitamin_mutagen( "mutagen" );
 static const vitamin_id vitamin_mutagen_human( "mutagen_human" );
 static const vitamin_id vitamin_mutagen_test_removal( "mutagen_test_removal" );
+static const vitamin_id vitamin_vitC( "vitC" );
 
 static std::string get_mutations_as_string( const Character &you );
 
@@ -771,3 +775,21 @@ TEST_CASE( "Threshold_substitutions", "[mutations]" )
     CHECK( !dummy.has_trait( trait_STR_ALPHA ) );
 }
 
+
+TEST_CASE( "vitamin_rates_match_single_vitamin_rates", "[mutations][vitamins]" )
+{
+    Character &dummy = get_player_character();
+    clear_avatar();
+    dummy.set_mutation( trait_RESISTANT_GENETICS );
+    dummy.set_mutation( trait_BLOODFEEDER );
+    REQUIRE( dummy.vitamin_rate( vitamin_vitC ) != vitamin_vitC->rate() );
+
+    const std::vector<time_duration> rates = dummy.vitamin_rates();
+    REQUIRE( rates.size() == vitamin::all().size() );
+    size_t i = 0;
+    for( const std::pair<const vitamin_id, vitamin> &v : vitamin::all() ) {
+        CAPTURE( v.first.str() );
+        CHECK( rates[i] == dummy.vitamin_rate( v.first ) );
+        ++i;
+    }
+}
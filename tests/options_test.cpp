@@ -5,9 +5,11 @@
 
 #include "cata_catch.h"
 #include "options.h"
+#include "options_helpers.h"
 #include "string_formatter.h"
 #include "translation.h"
 #include "type_id.h"
+#include "worldfactory.h"
 
 static const option_slider_id option_slider_test_world_difficulty( "test_world_difficulty" );
 
@@ -91,3 +93,34 @@ TEST_CASE( "option_slider_test", "[option]" )
     }
     CHECK( checked == num_slider_options );
 }
+
+TEST_CASE( "option_ref_follows_option_changes", "[option]" )
+{
+    const option_ref<int> autosave_turns( "AUTOSAVE_TURNS" );
+    const option_ref<std::string> units( "USE_CELSIUS" );
+    const option_ref<bool> force_redraw( "FORCE_REDRAW" );
+
+    const int old_turns = get_option<int>( "AUTOSAVE_TURNS" );
+    CHECK( autosave_turns.get() == old_turns );
+    {
+        override_option turns( "AUTOSAVE_TURNS", std::to_string( old_turns + 1 ) );
+        override_option celsius( "USE_CELSIUS", "kelvin" );
+        override_option redraw( "FORCE_REDRAW", "true" );
+        CHECK( autosave_turns.get() == old_turns + 1 );
+        CHECK( units.get() == "kelvin" );
+        CHECK( force_redraw.get() );
+    }
+    CHECK( autosave_turns.get() == old_turns );
+    CHECK( units.get() == get_option<std::string>( "USE_CELSIUS" ) );
+    CHECK( force_redraw.get() == get_option<bool>( "FORCE_REDRAW" ) );
+
+    // Changing what world the options come from counts as a change as well
+    const option_ref<float> evolution( "EVOLUTION_INVERSE_MULTIPLIER" );
+    options_manager::options_container world = get_options().get_world_defaults();
+    world["EVOLUTION_INVERSE_MULTIPLIER"].setValue( 0.5f );
+    const float old_evolution = evolution.get();
+    get_options().set_world_options( &world );
+    CHECK( evolution.get() == Approx( 0.5f ) );
+    world_generator->set_active_world( world_generator->active_world );
+    CHECK( evolution.get() == Approx( old_evolution ) );
+}
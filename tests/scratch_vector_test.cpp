@@ -0,0 +1,44 @@
+#include <vector>
+
+#include "cata_catch.h"
+#include "scratch_vector.h"
+
+namespace
+{
+// Element type of its own, so that no other code shares the pool.
+struct scratch_test_entry {
+    int value;
+};
+} // namespace
+
+TEST_CASE( "scratch_vectors_are_reused", "[nogame]" )
+{
+    scratch_vectors::take_allocation_count();
+    const std::vector<scratch_test_entry> *first = nullptr;
+    {
+        scratch_vector<scratch_test_entry> scratch;
+        std::vector<scratch_test_entry> &entries = scratch.get();
+        first = &entries;
+        for( int i = 0; i < 100; ++i ) {
+            entries.push_back( { i } );
+        }
+    }
+    CHECK( scratch_vectors::take_allocation_count() == 2 );
+
+    {
+        scratch_vector<scratch_test_entry> scratch;
+        std::vector<scratch_test_entry> &entries = scratch.get();
+        CHECK( &entries == first );
+        CHECK( entries.empty() );
+        CHECK( entries.capacity() >= 100 );
+        for( int i = 0; i < 100; ++i ) {
+            entries.push_back( { i } );
+        }
+
+        scratch_vector<scratch_test_entry> nested;
+        CHECK( &nested.get() != first );
+    }
+    // Only the nested vector had to be allocated.
+    CHECK( scratch_vectors::take_allocation_count() == 1 );
+    CHECK( scratch_vectors::take_allocation_count() == 0 );
+}
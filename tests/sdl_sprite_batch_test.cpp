@@ -0,0 +1,160 @@
+#if defined(TILES)
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "cata_catch.h"
+#include "point.h"
+#include "sdl_sprite_batch.h"
+#include "sdl_wrappers.h"
+
+namespace
+{
+
+// A renderer drawing into a plain surface, so nothing needs a window.
+struct software_target {
+    SDL_Surface_Ptr surface;
+    SDL_Renderer_Ptr renderer;
+    SDL_Texture_Ptr atlas;
+
+    software_target( int w, int h ) {
+        surface.reset( SDL_CreateRGBSurfaceWithFormat( 0, w, h, 32, SDL_PIXELFORMAT_ARGB8888 ) );
+        REQUIRE( surface );
+        renderer.reset( SDL_CreateSoftwareRenderer( surface.get() ) );
+        REQUIRE( renderer );
+
+        // 64x64 atlas made of four solid 32x32 quadrants:
+        // red, green on top, blue, white at the bottom.
+        SDL_Surface_Ptr atlas_surf( SDL_CreateRGBSurfaceWithFormat( 0, 64, 64, 32,
+                                    SDL_PIXELFORMAT_ARGB8888 ) );
+        REQUIRE( atlas_surf );
+        const std::array<std::array<Uint8, 3>, 4> colors = {{
+                { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 }, { 255, 255, 255 }
+            }
+        };
+        for( int i = 0; i < 4; ++i ) {
+            SDL_Rect quad{ ( i % 2 ) * 32, ( i / 2 ) * 32, 32, 32 };
+            FillRect( atlas_surf, &quad, SDL_MapRGB( atlas_surf->format, colors[i][0], colors[i][1],
+                      colors[i][2] ) );
+        }
+        atlas = CreateTextureFromSurface( renderer, atlas_surf );
+        REQUIRE( atlas );
+    }
+
+    void clear() {
+        SetRenderDrawColor( renderer, 0, 0, 0, 255 );
+        RenderClear( renderer );
+    }
+
+    Uint32 pixel( const point &p ) {
+        SDL_RenderFlush( renderer.get() );
+        const Uint8 *row = static_cast<const Uint8 *>( surface->pixels ) + p.y * surface->pitch;
+        return reinterpret_cast<const Uint32 *>( row )[p.x] & 0xffffff;
+    }
+};
+
+struct sprite {
+    SDL_Rect src;
+    SDL_Rect dst;
+    double angle;
+    SDL_RendererFlip flip;
+};
+
+void draw_sprites( software_target &t, SpriteBatch &batch, const std::vector<sprite> &sprites )
+{
+    for( const sprite &s : sprites ) {
+        CHECK( batch.render_copy_ex( t.renderer, t.atlas.get(), s.src, s.dst, s.angle, s.flip ) == 0 );
+    }
+    batch.flush( t.renderer );
+}
+
+} // namespace
+
+static constexpr Uint32 red = 0xff0000;
+static constexpr Uint32 green = 0x00ff00;
+static constexpr Uint32 blue = 0x0000ff;
+static constexpr Uint32 white = 0xffffff;
+
+TEST_CASE( "sprite_batch_matches_direct_rendering", "[tiles][sdl]" )
+{
+    const std::vector<sprite> sprites = {
+        // each quadrant, unrotated
+        { { 0, 0, 32, 32 }, { 0, 0, 32, 32 }, 0, SDL_FLIP_NONE },
+        { { 32, 0, 32, 32 }, { 32, 0, 32, 32 }, 0, SDL_FLIP_NONE },
+        { { 0, 32, 32, 32 }, { 64, 0, 32, 32 }, 0, SDL_FLIP_NONE },
+        { { 32, 32, 32, 32 }, { 96, 0, 32, 32 }, 0, SDL_FLIP_NONE },
+        // top row flipped horizontally: green left, red right
+        { { 0, 0, 64, 32 }, { 0, 64, 64, 32 }, 0, SDL_FLIP_HORIZONTAL },
+        // whole atlas rotated 90 degrees clockwise: red ends up top right
+        { { 0, 0, 64, 64 }, { 64, 64, 64, 64 }, 90, SDL_FLIP_NONE },
+        // whole atlas flipped both ways: white ends up top left
+        {
+            { 0, 0, 64, 64 }, { 0, 128, 64, 64 }, 0,
+            static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL )
+        },
+    };
+    const std::vector<std::pair<point, Uint32>> expected = {
+        { { 16, 16 }, red }, { { 48, 16 }, green }, { { 80, 16 }, blue }, { { 112, 16 }, white },
+        { { 16, 80 }, green }, { { 48, 80 }, red },
+        { { 112, 80 }, red }, { { 80, 80 }, blue }, { { 112, 112 }, green }, { { 80, 112 }, white },
+        { { 16, 144 }, white }, { { 48, 144 }, blue }, { { 16, 176 }, green }, { { 48, 176 }, red },
+    };
+
+    software_target direct( 128, 192 );
+    software_target batched( 128, 192 );
+    direct.clear();
+    batched.clear();
+
+    SpriteBatch off;
+    draw_sprites( direct, off, sprites );
+
+    SpriteBatch on;
+    on.set_enabled( batched.renderer, true );
+    for( const sprite &s : sprites ) {
+        on.render_copy_ex( batched.renderer, batched.atlas.get(), s.src, s.dst, s.angle, s.flip );
+    }
+    if( on.uses_geometry() ) {
+        // nothing is drawn before the flush
+        CHECK( on.queued() == sprites.size() );
+        CHECK( batched.pixel( { 16, 16 } ) == 0 );
+    }
+    on.set_enabled( batched.renderer, false );
+    CHECK( on.queued() == 0 );
+
+    for( const std::pair<point, Uint32> &e : expected ) {
+        CAPTURE( e.first );
+        CHECK( direct.pixel( e.first ) == e.second );
+        CHECK( batched.pixel( e.first ) == e.second );
+    }
+}
+
+TEST_CASE( "sprite_batch_frame_time_benchmark", "[.][tiles][sdl][benchmark]" )
+{
+    // Roughly a zoomed out view: 128x96 tiles of 8x8 pixels, two sprites each.
+    software_target t( 1024, 768 );
+    std::vector<sprite> sprites;
+    for( int y = 0; y < 96; ++y ) {
+        for( int x = 0; x < 128; ++x ) {
+            const SDL_Rect dst{ x * 8, y * 8, 8, 8 };
+            sprites.push_back( { { ( x % 2 ) * 32, 0, 32, 32 }, dst, 0, SDL_FLIP_NONE } );
+            sprites.push_back( { { 32, 32, 32, 32 }, dst, ( y % 4 ) * 90.0, SDL_FLIP_NONE } );
+        }
+    }
+
+    SpriteBatch batch;
+    BENCHMARK( "SDL_RenderCopyEx per sprite" ) {
+        t.clear();
+        draw_sprites( t, batch, sprites );
+        return t.pixel( { 0, 0 } );
+    };
+    batch.set_enabled( t.renderer, true );
+    BENCHMARK( "batched with SDL_RenderGeometry" ) {
+        t.clear();
+        draw_sprites( t, batch, sprites );
+        return t.pixel( { 0, 0 } );
+    };
+    batch.set_enabled( t.renderer, false );
+}
+
+#endif // TILES
@@ -5,6 +5,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -19,8 +20,10 @@
 #include "flexbuffer_json.h"
 #include "game.h"
 #include "item.h"
+#include "json.h"
 #include "json_loader.h"
 #include "map_scale_constants.h"
+#include "mapbuffer.h"
 #include "point.h"
 #include "string_formatter.h"
 #include "submap.h"
@@ -45,6 +48,7 @@ static const furn_str_id furn_f_crate_o( "f_crate_o" );
 static const furn_str_id furn_f_dresser( "f_dresser" );
 static const furn_str_id furn_f_gas_tank( "f_gas_tank" );
 static const furn_str_id furn_test_f_migration_new_id( "test_f_migration_new_id" );
+static const furn_str_id furn_test_f_migration_old_id( "test_f_migration_old_id" );
 
 static const itype_id itype_bat_nerf( "bat_nerf" );
 static const itype_id itype_bottle_plastic( "bottle_plastic" );
@@ -60,6 +64,7 @@ static const ter_str_id ter_t_floor_green( "t_floor_green" );
 static const ter_str_id ter_t_floor_red( "t_floor_red" );
 static const ter_str_id ter_t_rock_floor( "t_rock_floor" );
 static const ter_str_id ter_test_t_migration_new_id( "test_t_migration_new_id" );
+static const ter_str_id ter_test_t_migration_old_id( "test_t_migration_old_id" );
 
 static const trap_str_id tr_beartrap( "tr_beartrap" );
 static const trap_str_id tr_bubblewrap( "tr_bubblewrap" );
@@ -1558,3 +1563,95 @@ TEST_CASE( "submap_fd_migration", "[submap][load]" )
     INFO( string_format( "%d fields found: %s", total_fields, fields_list ) );
     REQUIRE( ( found_field_new_id && total_fields == 1 ) );
 }
+
+static std::string submap_json( const submap &sm )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_object();
+    sm.store( jsout );
+    jsout.end_object();
+    return os.str();
+}
+
+TEST_CASE( "submap_quad_json_load", "[submap][load]" )
+{
+    // Quads saved before the binary format, and with it switched off, are json arrays.
+    const mapbuffer::quad_submaps quad = mapbuffer::decode_quad(
+            "[" + submap_furniture_ss + "," + submap_ter_furn_pre_migration_ss + "]" );
+    REQUIRE( quad.size() == 2 );
+    CHECK( quad[0].first == tripoint_abs_sm::zero );
+    CHECK( quad[0].second->get_furn( corner_nw ) == furn_f_coffin_c );
+    CHECK( quad[0].second->get_furn( random_pt ) == furn_f_gas_tank );
+    CHECK( quad[1].second->get_ter( corner_ne ) == ter_test_t_migration_new_id );
+    CHECK( quad[1].second->get_furn( corner_se ) == furn_test_f_migration_new_id );
+}
+
+TEST_CASE( "submap_binary_quad_round_trip", "[submap][load]" )
+{
+    std::vector<submap> submaps( 4 );
+    load_from_jsin( submaps[0], submap_terrain_rle );
+    load_from_jsin( submaps[1], submap_furniture );
+    load_from_jsin( submaps[2], submap_item );
+    load_from_jsin( submaps[3], submap_field );
+    submaps[3].set_trap( random_pt, tr_beartrap.id() );
+    submaps[3].set_radiation( corner_se, 12 );
+    std::vector<std::pair<tripoint_abs_sm, const submap *>> quad;
+    for( int i = 0; i < 4; ++i ) {
+        quad.emplace_back( tripoint_abs_sm( 10 + i % 2, -4 + i / 2, 1 ), &submaps[i] );
+    }
+
+    const std::string encoded = mapbuffer::encode_binary_quad( quad );
+    const mapbuffer::quad_submaps decoded = mapbuffer::decode_quad( encoded );
+    REQUIRE( decoded.size() == quad.size() );
+    for( size_t i = 0; i < quad.size(); ++i ) {
+        CAPTURE( i );
+        CHECK( decoded[i].first == quad[i].first );
+        CHECK( submap_json( *decoded[i].second ) == submap_json( *quad[i].second ) );
+    }
+
+    SECTION( "corrupt or truncated data is rejected" ) {
+        for( size_t size : { size_t( 3 ), size_t( 16 ), encoded.size() / 2, encoded.size() - 1 } ) {
+            CAPTURE( size );
+            CHECK_THROWS( mapbuffer::decode_quad( encoded.substr( 0, size ) ) );
+        }
+        std::string wrong_version = encoded;
+        wrong_version[4] = 99;
+        CHECK_THROWS( mapbuffer::decode_quad( wrong_version ) );
+        // Header, submap count, position and version, then the terrain palette of the first
+        // submap: its size and the t_floor_red, t_dirt, ... ids.  Point the first tile past it.
+        std::string bad_index = encoded;
+        const size_t palette_start = 16 + 4 + 4 * 4;
+        const size_t palette_size = static_cast<unsigned char>( bad_index[palette_start] );
+        size_t first_index = palette_start + 2;
+        for( size_t i = 0; i < palette_size; ++i ) {
+            first_index += 4 + static_cast<unsigned char>( bad_index[first_index] );
+        }
+        bad_index[first_index] = static_cast<char>( palette_size );
+        CHECK_THROWS( mapbuffer::decode_quad( bad_index ) );
+    }
+}
+
+TEST_CASE( "submap_binary_palette_migration", "[submap][load]" )
+{
+    submap_ter_furn ter_furn;
+    ter_furn.ter_palette = { ter_t_dirt, ter_test_t_migration_old_id };
+    ter_furn.furn_palette = { furn_str_id::NULL_ID(), furn_test_f_migration_old_id };
+    for( int y = 0; y < SEEY; ++y ) {
+        for( int x = 0; x < SEEX; ++x ) {
+            ter_furn.ter[x][y] = 0;
+            ter_furn.furn[x][y] = 0;
+        }
+    }
+    ter_furn.ter[corner_ne.x()][corner_ne.y()] = 1;
+    ter_furn.furn[corner_se.x()][corner_se.y()] = 1;
+
+    submap sm;
+    sm.load( ter_furn );
+    CHECK( sm.get_ter( corner_ne ) == ter_test_t_migration_new_id );
+    CHECK( sm.get_furn( corner_ne ) == furn_test_f_migration_new_id );
+    CHECK( sm.get_ter( corner_se ) == ter_t_dirt );
+    CHECK( sm.get_furn( corner_se ) == furn_test_f_migration_new_id );
+    CHECK( sm.get_ter( random_pt ) == ter_t_dirt );
+    CHECK( sm.get_furn( random_pt ) == furn_str_id::NULL_ID() );
+}
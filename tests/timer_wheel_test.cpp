@@ -0,0 +1,83 @@
+#include <cstdint>
+#include <vector>
+
+#include "cata_catch.h"
+#include "rng.h"
+#include "timer_wheel.h"
+
+static std::vector<int> advance_to( timer_wheel<int> &wheel, std::int64_t now )
+{
+    std::vector<int> out;
+    wheel.advance( now, out );
+    return out;
+}
+
+TEST_CASE( "timer_wheel_expires_in_order", "[timer_wheel]" )
+{
+    timer_wheel<int> wheel;
+    advance_to( wheel, 1000 );
+
+    // one entry per level, one in the overflow list and one already due
+    const std::vector<std::int64_t> offsets = { 5, 63, 64, 100, 4095, 4096, 300000, 20000000, 0 };
+    for( std::size_t i = 0; i < offsets.size(); ++i ) {
+        wheel.insert( 1000 + offsets[i], static_cast<int>( i ) );
+    }
+    CHECK( wheel.size() == offsets.size() );
+
+    CHECK( advance_to( wheel, 1000 ) == std::vector<int> { 8 } );
+    CHECK( advance_to( wheel, 1004 ).empty() );
+    CHECK( advance_to( wheel, 1005 ) == std::vector<int> { 0 } );
+    CHECK( advance_to( wheel, 1100 ) == std::vector<int> { 1, 2, 3 } );
+    CHECK( advance_to( wheel, 1000 + 4095 ) == std::vector<int> { 4 } );
+    CHECK( advance_to( wheel, 1000 + 299999 ) == std::vector<int> { 5 } );
+    CHECK( advance_to( wheel, 1000 + 300000 ) == std::vector<int> { 6 } );
+    CHECK( advance_to( wheel, 1000 + 19999999 ).empty() );
+    CHECK( advance_to( wheel, 1000 + 20000000 ) == std::vector<int> { 7 } );
+    CHECK( wheel.empty() );
+}
+
+TEST_CASE( "timer_wheel_matches_brute_force", "[timer_wheel]" )
+{
+    timer_wheel<int> wheel;
+    std::vector<std::int64_t> times;
+    std::vector<bool> expired;
+    std::int64_t now = -5000;
+    advance_to( wheel, now );
+    for( int i = 0; i < 2000; ++i ) {
+        const std::int64_t when = now + rng( -10, 100000 );
+        wheel.insert( when, static_cast<int>( times.size() ) );
+        times.push_back( when );
+        expired.push_back( false );
+        if( !one_in( 4 ) ) {
+            continue;
+        }
+        now += rng( 0, 300 );
+        for( int id : advance_to( wheel, now ) ) {
+            CHECK_FALSE( expired[id] );
+            expired[id] = true;
+        }
+        for( std::size_t id = 0; id < times.size(); ++id ) {
+            if( expired[id] != ( times[id] <= now ) ) {
+                CAPTURE( now, times[id] );
+                CHECK( expired[id] == ( times[id] <= now ) );
+            }
+        }
+    }
+    now += 200000;
+    advance_to( wheel, now );
+    CHECK( wheel.empty() );
+}
+
+TEST_CASE( "timer_wheel_going_back_in_time", "[timer_wheel]" )
+{
+    timer_wheel<int> wheel;
+    advance_to( wheel, 10000 );
+    wheel.insert( 10500, 1 );
+    wheel.insert( 20000, 2 );
+    CHECK( advance_to( wheel, 100 ).empty() );
+    CHECK( advance_to( wheel, 10499 ).empty() );
+    CHECK( advance_to( wheel, 10500 ) == std::vector<int> { 1 } );
+    wheel.insert( 9000, 3 );
+    CHECK( advance_to( wheel, 10500 ) == std::vector<int> { 3 } );
+    CHECK( advance_to( wheel, 20000 ) == std::vector<int> { 2 } );
+}
@@ -0,0 +1,58 @@
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "cata_catch.h"
+#include "global_vars.h"
+#include "json.h"
+#include "json_loader.h"
+#include "math_parser_diag_value.h"
+#include "var_key.h"
+
+TEST_CASE( "var_key_interning", "[var_key][nogame]" )
+{
+    const var_key a( "test_var_key_a" );
+    const std::string a_name = "test_var_key_a";
+    const std::string_view a_view = a_name;
+
+    CHECK( var_key( a_name ) == a );
+    CHECK( var_key( a_view ) == a );
+    CHECK( var_key( a_view ).index() == a.index() );
+    CHECK( a.str() == "test_var_key_a" );
+    CHECK( var_key( "test_var_key_b" ) != a );
+    CHECK( var_key( "test_var_key_b" ).str() == "test_var_key_b" );
+
+    CHECK( var_key().empty() );
+    CHECK( var_key( "" ) == var_key() );
+    CHECK_FALSE( a.empty() );
+
+    // ordered by name, not by when the name was first seen
+    CHECK_FALSE( var_key( "test_var_key_z" ) < var_key( "test_var_key_y" ) );
+    CHECK( var_key( "test_var_key_y" ) < var_key( "test_var_key_z" ) );
+    CHECK_FALSE( a < a );
+}
+
+TEST_CASE( "var_key_maps_save_by_name", "[var_key][nogame]" )
+{
+    global_variables globals;
+    globals.set_global_value( "test_var_key_saved", "value" );
+    globals.set_global_value( "test_var_key_number", 5 );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_object();
+    globals.serialize( jsout );
+    jsout.end_object();
+    const std::string saved = os.str();
+    CHECK( saved.find( R"("test_var_key_saved")" ) != std::string::npos );
+    CHECK( saved.find( R"("test_var_key_number")" ) != std::string::npos );
+
+    // Loading only sees names, so keys interned in a different order load the same.
+    global_variables loaded;
+    JsonObject jo = json_loader::from_string( saved );
+    loaded.unserialize( jo );
+    CHECK( loaded.get_global_values().size() == 2 );
+    CHECK( loaded.get_global_value( "test_var_key_saved" ).str() == "value" );
+    CHECK( loaded.get_global_value( var_key( "test_var_key_number" ) ).dbl() == 5 );
+    CHECK( loaded.maybe_get_global_value( "test_var_key_missing" ) == nullptr );
+}
@@ -3,6 +3,7 @@
 #include <functional>
 #include <map>
 #include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -56,6 +57,8 @@ static const itype_id itype_test_power_cord( "test_power_cord" );
 static const itype_id itype_test_squishy_fruit( "test_squishy_fruit" );
 static const itype_id itype_test_standing_lamp( "test_standing_lamp" );
 
+static const ter_str_id ter_t_wall( "t_wall" );
+
 static const vpart_id vpart_ap_test_standing_lamp( "ap_test_standing_lamp" );
 static const vpart_id vpart_bike_rack( "bike_rack" );
 static const vpart_id vpart_programmable_autopilot( "programmable_autopilot" );
@@ -987,3 +990,57 @@ TEST_CASE( "vehicle_wheels_damaged_by_running_over_items", "[vehicle]" )
         run_squish_test( test_items, test_point, here, veh_ptr, vp_wheel );
     }
 }
+
+TEST_CASE( "vehicle_footprint_sweep_and_cache_delta", "[vehicle]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint_bub_ms test_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vehicle_prototype_car, test_origin, 0_degrees, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    const tripoint_rel_ms dp( 1, 0, 0 );
+    veh.precalc_mounts( 1, veh.face.dir(), veh.pivot_point( here ) );
+    veh.part_project_points( dp );
+
+    // A projected point that the vehicle doesn't cover yet
+    const std::set<tripoint_abs_ms> &covered = veh.get_points( true );
+    std::optional<tripoint_bub_ms> ahead;
+    for( const tripoint_abs_ms &p : veh.get_projected_part_points() ) {
+        if( covered.count( p ) == 0 ) {
+            ahead = here.get_bub( p );
+            break;
+        }
+    }
+    REQUIRE( ahead.has_value() );
+
+    std::vector<veh_collision> colls;
+    SECTION( "open ground" ) {
+        CHECK( veh.footprint_is_clear( here ) );
+        CHECK_FALSE( veh.collision( here, colls, dp, true ) );
+    }
+    SECTION( "wall ahead" ) {
+        REQUIRE( here.ter_set( *ahead, ter_t_wall ) );
+        CHECK_FALSE( veh.footprint_is_clear( here ) );
+        CHECK( veh.collision( here, colls, dp, true ) );
+    }
+    SECTION( "monster ahead" ) {
+        spawn_test_monster( "mon_zombie", *ahead );
+        CHECK_FALSE( veh.footprint_is_clear( here ) );
+        CHECK( veh.collision( here, colls, dp, true ) );
+    }
+    SECTION( "vehicle caches follow a move" ) {
+        const std::set<tripoint_abs_ms> old_points = covered;
+        REQUIRE( here.displace_vehicle( veh, dp ) );
+        const std::set<tripoint_abs_ms> &new_points = veh.get_points( true );
+        for( const tripoint_abs_ms &p : new_points ) {
+            const optional_vpart_position ovp = here.veh_at( p );
+            CHECK( ( ovp && &ovp->vehicle() == &veh ) );
+        }
+        for( const tripoint_abs_ms &p : old_points ) {
+            if( new_points.count( p ) == 0 ) {
+                CHECK_FALSE( here.veh_at( p ) );
+            }
+        }
+    }
+}